@@ -6,6 +6,9 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
+//  [X] Renderer: Signed distance field fonts (ImFontAtlasFlags_SDF, ImGuiBackendFlags_RendererHasSdfFonts). [ES 2.0: requires GL_OES_standard_derivatives for best quality]
+//  [X] Renderer: Multiple font atlas texture pages (ImFontAtlas::TexPageSize, ImGuiBackendFlags_RendererHasTexPages).
+//  [X] Renderer: Single channel and BC4 compressed font textures (ImFontAtlasFlags_TexFormatAlpha8, ImFontAtlasFlags_TexFormatBC4). [BC4: requires GL 3.0+ or GL_EXT_texture_compression_rgtc]
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -22,6 +25,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: OpenGL: Support for ImFontAtlasFlags_TexFormatAlpha8 and ImFontAtlasFlags_TexFormatBC4: font texture is uploaded as GL_R8/GL_LUMINANCE or GL_COMPRESSED_RED_RGTC1, and expanded to (1,1,1,alpha) in the fragment shader.
+//  2026-10-19: OpenGL: Support for font atlases with multiple texture pages (ImFontAtlas::TexPageSize): one texture is created per page. Set ImGuiBackendFlags_RendererHasTexPages.
+//  2026-10-19: OpenGL: Support for font atlases built with ImFontAtlasFlags_SDF: distance field is decoded in the fragment shader when drawing with the font texture. Set ImGuiBackendFlags_RendererHasSdfFonts.
 //  2024-10-07: OpenGL: Changed default texture sampler to Clamp instead of Repeat/Wrap.
 //  2024-06-28: OpenGL: ImGui_ImplOpenGL3_NewFrame() recreates font texture if it has been destroyed by ImGui_ImplOpenGL3_DestroyFontsTexture(). (#7748)
 //  2024-05-07: OpenGL: Update loader for Linux to support EGL/GLVND. (#7562)
@@ -210,6 +216,21 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Single channel and compressed font texture formats. Not all headers have them, and we only use them after checking GL version/extensions at runtime.
+// (GL_LUMINANCE is not in core profile headers, GL_R8/GL_RED are not in GL ES 2.0 headers, GL_COMPRESSED_RED_RGTC1 is an extension in GL ES)
+#ifndef GL_LUMINANCE
+#define GL_LUMINANCE                0x1909
+#endif
+#ifndef GL_RED
+#define GL_RED                      0x1903
+#endif
+#ifndef GL_R8
+#define GL_R8                       0x8229
+#endif
+#ifndef GL_COMPRESSED_RED_RGTC1
+#define GL_COMPRESSED_RED_RGTC1     0x8DBB
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -229,8 +250,13 @@ struct ImGui_ImplOpenGL3_Data
     bool            GlProfileIsCompat;
     GLint           GlProfileMask;
     GLuint          FontTexture;
+    ImVector<GLuint> FontTexturePages;       // Textures of font atlas pages 1+ (page 0 is FontTexture)
+    bool            FontTextureIsSdf;        // Font atlas was built with ImFontAtlasFlags_SDF
+    bool            FontTextureIsAlpha;      // Font atlas was uploaded as a single channel texture (GL_R8, GL_LUMINANCE or GL_COMPRESSED_RED_RGTC1)
     GLuint          ShaderHandle;
     GLint           AttribLocationTex;       // Uniforms location
+    GLint           AttribLocationTexSdf;
+    GLint           AttribLocationTexAlpha;
     GLint           AttribLocationProjMtx;
     GLuint          AttribLocationVtxPos;    // Vertex attributes location
     GLuint          AttribLocationVtxUV;
@@ -240,6 +266,7 @@ struct ImGui_ImplOpenGL3_Data
     GLsizeiptr      IndexBufferSize;
     bool            HasPolygonMode;
     bool            HasClipOrigin;
+    bool            HasCompressionRGTC;
     bool            UseBufferSubData;
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
@@ -344,6 +371,8 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     if (bd->GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasSdfFonts;       // We can decode font atlases built with ImFontAtlasFlags_SDF.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexPages;       // We can upload font atlases with multiple texture pages.
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to nullptr if unsure.
@@ -373,6 +402,7 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     bd->HasPolygonMode = (!bd->GlProfileIsES2 && !bd->GlProfileIsES3);
 #endif
     bd->HasClipOrigin = (bd->GlVersion >= 450);
+    bd->HasCompressionRGTC = (bd->GlVersion >= 300 && !bd->GlProfileIsES3);
 #ifdef IMGUI_IMPL_OPENGL_HAS_EXTENSIONS
     GLint num_extensions = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
@@ -381,7 +411,13 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
         if (extension != nullptr && strcmp(extension, "GL_ARB_clip_control") == 0)
             bd->HasClipOrigin = true;
+        if (extension != nullptr && (strcmp(extension, "GL_ARB_texture_compression_rgtc") == 0 || strcmp(extension, "GL_EXT_texture_compression_rgtc") == 0))
+            bd->HasCompressionRGTC = true;
     }
+#else
+    if (const char* extensions = (const char*)glGetString(GL_EXTENSIONS)) // GL ES: glGetString(GL_EXTENSIONS) is still available in ES 3.x.
+        if (strstr(extensions, "GL_EXT_texture_compression_rgtc") != nullptr)
+            bd->HasCompressionRGTC = true;
 #endif
 
     return true;
@@ -396,7 +432,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasSdfFonts | ImGuiBackendFlags_RendererHasTexPages);
     IM_DELETE(bd);
 }
 
@@ -462,6 +498,8 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     };
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
+    glUniform1f(bd->AttribLocationTexSdf, 0.0f);
+    glUniform1f(bd->AttribLocationTexAlpha, 0.0f);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
@@ -551,6 +589,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
     // Render command lists
+    bool tex_font = false; // Font texture uniforms (TextureSdf, TextureAlpha) are set
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* draw_list = draw_data->CmdLists[n];
@@ -594,7 +633,10 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    tex_font = false;
+                }
                 else
                     pcmd->UserCallback(draw_list, pcmd);
             }
@@ -610,7 +652,14 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
 
                 // Bind texture, Draw
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                const GLuint tex_id = (GLuint)(intptr_t)pcmd->GetTexID();
+                GL_CALL(glBindTexture(GL_TEXTURE_2D, tex_id));
+                if ((bd->FontTextureIsSdf || bd->FontTextureIsAlpha) && (tex_id == bd->FontTexture || bd->FontTexturePages.contains(tex_id)) != tex_font)
+                {
+                    tex_font = !tex_font;
+                    GL_CALL(glUniform1f(bd->AttribLocationTexSdf, (tex_font && bd->FontTextureIsSdf) ? 1.0f : 0.0f));
+                    GL_CALL(glUniform1f(bd->AttribLocationTexAlpha, (tex_font && bd->FontTextureIsAlpha) ? 1.0f : 0.0f));
+                }
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
                     GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
@@ -672,30 +721,69 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
     // Build texture atlas
+    // - By default load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders.
+    // - With ImFontAtlasFlags_TexFormatAlpha8 or ImFontAtlasFlags_TexFormatBC4, load as a single channel texture which our shader expands to (1,1,1,alpha).
+    //   BC4 requires GL 3.0+ or GL_EXT_texture_compression_rgtc. GL 2.x and GL ES 2.0 use GL_LUMINANCE instead of GL_R8.
     unsigned char* pixels;
     int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit (75% of the memory is wasted, but default font is so small) because it is more likely to be compatible with user's existing shaders. If your ImTextureId represent a higher-level concept than just a GL texture id, consider calling GetTexDataAsAlpha8() instead to save on GPU memory.
+    size_t page_size;
+    GLint internal_format = GL_RGBA;
+    GLenum format = GL_RGBA;
+    const bool use_alpha = (io.Fonts->Flags & (ImFontAtlasFlags_TexFormatAlpha8 | ImFontAtlasFlags_TexFormatBC4)) != 0 && !io.Fonts->TexPixelsUseColors;
+    if (use_alpha && (io.Fonts->Flags & ImFontAtlasFlags_TexFormatBC4) && bd->HasCompressionRGTC)
+    {
+        int bytes_per_page;
+        io.Fonts->GetTexDataAsBC4(&pixels, &width, &height, &bytes_per_page);
+        page_size = (size_t)bytes_per_page;
+        internal_format = GL_COMPRESSED_RED_RGTC1;
+    }
+    else if (use_alpha)
+    {
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
+        page_size = (size_t)width * height;
+        internal_format = (bd->GlVersion >= 300) ? GL_R8 : GL_LUMINANCE;
+        format = (bd->GlVersion >= 300) ? GL_RED : GL_LUMINANCE;
+    }
+    else
+    {
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+        page_size = (size_t)width * height * 4;
+    }
 
-    // Upload texture to graphics system
+    // Upload texture to graphics system, one texture per atlas page (pages are stored one after the other in 'pixels')
     // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling)
-    GLint last_texture;
+    GLint last_texture, last_unpack_alignment;
     GL_CALL(glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture));
-    GL_CALL(glGenTextures(1, &bd->FontTexture));
-    GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->FontTexture));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
-    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+    GL_CALL(glGetIntegerv(GL_UNPACK_ALIGNMENT, &last_unpack_alignment));
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1)); // Single channel rows may not be 4 bytes aligned
+    const int tex_page_count = io.Fonts->GetTexPageCount();
+    bd->FontTexturePages.resize(tex_page_count - 1);
+    for (int tex_page = 0; tex_page < tex_page_count; tex_page++)
+    {
+        GLuint* texture = (tex_page == 0) ? &bd->FontTexture : &bd->FontTexturePages[tex_page - 1];
+        GL_CALL(glGenTextures(1, texture));
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, *texture));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
 #ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
-    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+        GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
 #endif
-    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+        if (internal_format == GL_COMPRESSED_RED_RGTC1)
+            GL_CALL(glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RED_RGTC1, width, height, 0, (GLsizei)page_size, pixels + tex_page * page_size));
+        else
+            GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, internal_format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels + tex_page * page_size));
 
-    // Store identifier
-    io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+        // Store identifier
+        io.Fonts->SetTexPageID(tex_page, (ImTextureID)(intptr_t)*texture);
+    }
+    bd->FontTextureIsSdf = (io.Fonts->Flags & ImFontAtlasFlags_SDF) != 0;
+    bd->FontTextureIsAlpha = (internal_format != GL_RGBA);
 
     // Restore state
     GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
+    GL_CALL(glPixelStorei(GL_UNPACK_ALIGNMENT, last_unpack_alignment));
 
     return true;
 }
@@ -710,6 +798,13 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
         io.Fonts->SetTexID(0);
         bd->FontTexture = 0;
     }
+    if (bd->FontTexturePages.Size > 0)
+    {
+        glDeleteTextures(bd->FontTexturePages.Size, bd->FontTexturePages.Data);
+        for (int tex_page = 1; tex_page < io.Fonts->GetTexPageCount() && tex_page <= bd->FontTexturePages.Size; tex_page++)
+            io.Fonts->SetTexPageID(tex_page, 0);
+        bd->FontTexturePages.clear();
+    }
 }
 
 // If you get an error please report on github. You may try different GL context version or GLSL version. See GL<>GLSL version table at the top of this file.
@@ -828,47 +923,97 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
         "}\n";
 
+    // When TextureAlpha is set, the texture is a single channel font texture (GL_R8, GL_LUMINANCE or BC4) which we expand to (1,1,1,red).
+    // When TextureSdf is set, the texture alpha channel holds a signed distance field (0.5 on glyph edges, see ImFontAtlasFlags_SDF),
+    // which we turn into coverage with an anti-aliasing width of about one screen pixel.
     const GLchar* fragment_shader_glsl_120 =
         "#ifdef GL_ES\n"
+        "#ifdef GL_OES_standard_derivatives\n"
+        "#extension GL_OES_standard_derivatives : enable\n"
+        "#endif\n"
         "    precision mediump float;\n"
         "#endif\n"
         "uniform sampler2D Texture;\n"
+        "uniform float TextureSdf;\n"
+        "uniform float TextureAlpha;\n"
         "varying vec2 Frag_UV;\n"
         "varying vec4 Frag_Color;\n"
         "void main()\n"
         "{\n"
-        "    gl_FragColor = Frag_Color * texture2D(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture2D(Texture, Frag_UV.st);\n"
+        "    if (TextureAlpha > 0.0)\n"
+        "        tex = vec4(1.0, 1.0, 1.0, tex.r);\n"
+        "    if (TextureSdf > 0.0)\n"
+        "    {\n"
+        "#if defined(GL_ES) && !defined(GL_OES_standard_derivatives)\n"
+        "        float w = 0.1;\n"
+        "#else\n"
+        "        float w = max(fwidth(tex.a), 1.0 / 255.0);\n"
+        "#endif\n"
+        "        tex.a = clamp((tex.a - 0.5) / w + 0.5, 0.0, 1.0);\n"
+        "    }\n"
+        "    gl_FragColor = Frag_Color * tex;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_130 =
         "uniform sampler2D Texture;\n"
+        "uniform float TextureSdf;\n"
+        "uniform float TextureAlpha;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    if (TextureAlpha > 0.0)\n"
+        "        tex = vec4(1.0, 1.0, 1.0, tex.r);\n"
+        "    if (TextureSdf > 0.0)\n"
+        "    {\n"
+        "        float w = max(fwidth(tex.a), 1.0 / 255.0);\n"
+        "        tex.a = clamp((tex.a - 0.5) / w + 0.5, 0.0, 1.0);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_300_es =
         "precision mediump float;\n"
         "uniform sampler2D Texture;\n"
+        "uniform float TextureSdf;\n"
+        "uniform float TextureAlpha;\n"
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    if (TextureAlpha > 0.0)\n"
+        "        tex = vec4(1.0, 1.0, 1.0, tex.r);\n"
+        "    if (TextureSdf > 0.0)\n"
+        "    {\n"
+        "        float w = max(fwidth(tex.a), 1.0 / 255.0);\n"
+        "        tex.a = clamp((tex.a - 0.5) / w + 0.5, 0.0, 1.0);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex;\n"
         "}\n";
 
     const GLchar* fragment_shader_glsl_410_core =
         "in vec2 Frag_UV;\n"
         "in vec4 Frag_Color;\n"
         "uniform sampler2D Texture;\n"
+        "uniform float TextureSdf;\n"
+        "uniform float TextureAlpha;\n"
         "layout (location = 0) out vec4 Out_Color;\n"
         "void main()\n"
         "{\n"
-        "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    if (TextureAlpha > 0.0)\n"
+        "        tex = vec4(1.0, 1.0, 1.0, tex.r);\n"
+        "    if (TextureSdf > 0.0)\n"
+        "    {\n"
+        "        float w = max(fwidth(tex.a), 1.0 / 255.0);\n"
+        "        tex.a = clamp((tex.a - 0.5) / w + 0.5, 0.0, 1.0);\n"
+        "    }\n"
+        "    Out_Color = Frag_Color * tex;\n"
         "}\n";
 
     // Select shaders matching our GLSL versions
@@ -923,6 +1068,8 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     glDeleteShader(frag_handle);
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
+    bd->AttribLocationTexSdf = glGetUniformLocation(bd->ShaderHandle, "TextureSdf");
+    bd->AttribLocationTexAlpha = glGetUniformLocation(bd->ShaderHandle, "TextureAlpha");
     bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
     bd->AttribLocationVtxPos = (GLuint)glGetAttribLocation(bd->ShaderHandle, "Position");
     bd->AttribLocationVtxUV = (GLuint)glGetAttribLocation(bd->ShaderHandle, "UV");
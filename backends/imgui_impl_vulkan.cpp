@@ -4,6 +4,8 @@
 // Implemented features:
 //  [!] Renderer: User texture binding. Use 'VkDescriptorSet' as ImTextureID. Call ImGui_ImplVulkan_AddTexture() to register one. Read the FAQ about ImTextureID! See https://github.com/ocornut/imgui/pull/914 for discussions.
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Signed distance field fonts (ImFontAtlasFlags_SDF, ImGuiBackendFlags_RendererHasSdfFonts).
+//  [X] Renderer: Single channel and BC4 compressed font textures (ImFontAtlasFlags_TexFormatAlpha8, ImFontAtlasFlags_TexFormatBC4). [BC4: requires device support for sampling VK_FORMAT_BC4_UNORM_BLOCK]
 //  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
 
 // The aim of imgui_impl_vulkan.h/.cpp is to be usable in your engine without any modification.
@@ -26,6 +28,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: Vulkan: Support for ImFontAtlasFlags_TexFormatAlpha8 and ImFontAtlasFlags_TexFormatBC4: font texture is uploaded as VK_FORMAT_R8_UNORM or VK_FORMAT_BC4_UNORM_BLOCK, and expanded to (1,1,1,alpha) by the image view component mapping.
+//  2026-10-19: Vulkan: Support for font atlases built with ImFontAtlasFlags_SDF: font texture is drawn with a second pipeline decoding the distance field. Set ImGuiBackendFlags_RendererHasSdfFonts.
 //  2024-12-11: Vulkan: Fixed setting VkSwapchainCreateInfoKHR::preTransform for platforms not supporting VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR. (#8222)
 //  2024-11-27: Vulkan: Make user-provided descriptor pool optional. As a convenience, when setting init_info->DescriptorPoolSize the backend will create one itself. (#8172, #4867)
 //  2024-10-07: Vulkan: Changed default texture sampler to Clamp instead of Repeat/Wrap.
@@ -170,6 +174,7 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkFreeMemory) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetBufferMemoryRequirements) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetImageMemoryRequirements) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceFormatProperties) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceMemoryProperties) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceSurfaceCapabilitiesKHR) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkGetPhysicalDeviceSurfaceFormatsKHR) \
@@ -233,12 +238,15 @@ struct ImGui_ImplVulkan_Data
     VkDescriptorSetLayout       DescriptorSetLayout;
     VkPipelineLayout            PipelineLayout;
     VkPipeline                  Pipeline;
+    VkPipeline                  PipelineSdf;        // Same as Pipeline, with a fragment shader decoding ImFontAtlasFlags_SDF font atlases.
     VkShaderModule              ShaderModuleVert;
     VkShaderModule              ShaderModuleFrag;
+    VkShaderModule              ShaderModuleFragSdf;
     VkDescriptorPool            DescriptorPool;
 
     // Texture management
     ImGui_ImplVulkan_Texture    FontTexture;
+    bool                        FontTextureIsSdf;   // Font atlas was built with ImFontAtlasFlags_SDF
     VkSampler                   TexSampler;
     VkCommandPool               TexCommandPool;
     VkCommandBuffer             TexCommandBuffer;
@@ -362,6 +370,67 @@ static uint32_t __glsl_shader_frag_spv[] =
     0x00010038
 };
 
+// backends/vulkan/glsl_shader_sdf.frag
+// This one was assembled by hand from the source below, without glslangValidator, so its generator word is 0 (unknown tool).
+// It passes spirv-val (see our CI), which also compares it to the output of generate_spv.sh: replace it with that output when available.
+// # glslangValidator -V -x -o glsl_shader_sdf.frag.u32 glsl_shader_sdf.frag
+/*
+#version 450 core
+layout(location = 0) out vec4 fColor;
+layout(set=0, binding=0) uniform sampler2D sTexture;
+layout(location = 0) in struct { vec4 Color; vec2 UV; } In;
+void main()
+{
+    vec4 tex = texture(sTexture, In.UV.st);
+    float w = max(fwidth(tex.a), 1.0 / 255.0);
+    tex.a = clamp((tex.a - 0.5) / w + 0.5, 0.0, 1.0);
+    fColor = In.Color * tex;
+}
+*/
+static uint32_t __glsl_shader_sdf_frag_spv[] =
+{
+    0x07230203,0x00010000,0x00000000,0x00000035,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x00000001,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+    0x0007000f,0x00000004,0x00000004,0x6e69616d,0x00000000,0x00000012,0x0000002e,0x00030010,
+    0x00000004,0x00000007,0x00030003,0x00000002,0x000001c2,0x00040005,0x00000004,0x6e69616d,
+    0x00000000,0x00030005,0x00000009,0x00786574,0x00050005,0x0000000d,0x78655473,0x65727574,
+    0x00000000,0x00030005,0x00000010,0x00000000,0x00050006,0x00000010,0x00000000,0x6f6c6f43,
+    0x00000072,0x00040006,0x00000010,0x00000001,0x00005655,0x00030005,0x00000012,0x00006e49,
+    0x00030005,0x0000001a,0x00000077,0x00040005,0x0000002e,0x6c6f4366,0x0000726f,0x00040047,
+    0x0000000d,0x00000022,0x00000000,0x00040047,0x0000000d,0x00000021,0x00000000,0x00040047,
+    0x00000012,0x0000001e,0x00000000,0x00040047,0x0000002e,0x0000001e,0x00000000,0x00020013,
+    0x00000002,0x00030021,0x00000003,0x00000002,0x00030016,0x00000006,0x00000020,0x00040017,
+    0x00000007,0x00000006,0x00000004,0x00040020,0x00000008,0x00000007,0x00000007,0x00090019,
+    0x0000000a,0x00000006,0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,
+    0x0003001b,0x0000000b,0x0000000a,0x00040020,0x0000000c,0x00000000,0x0000000b,0x0004003b,
+    0x0000000c,0x0000000d,0x00000000,0x00040017,0x0000000f,0x00000006,0x00000002,0x0004001e,
+    0x00000010,0x00000007,0x0000000f,0x00040020,0x00000011,0x00000001,0x00000010,0x0004003b,
+    0x00000011,0x00000012,0x00000001,0x00040015,0x00000013,0x00000020,0x00000001,0x0004002b,
+    0x00000013,0x00000014,0x00000001,0x00040020,0x00000015,0x00000001,0x0000000f,0x00040020,
+    0x00000019,0x00000007,0x00000006,0x00040015,0x0000001b,0x00000020,0x00000000,0x0004002b,
+    0x0000001b,0x0000001c,0x00000003,0x0004002b,0x00000006,0x00000020,0x3b808081,0x0004002b,
+    0x00000006,0x00000024,0x3f000000,0x0004002b,0x00000006,0x00000029,0x00000000,0x0004002b,
+    0x00000006,0x0000002a,0x3f800000,0x00040020,0x0000002d,0x00000003,0x00000007,0x0004003b,
+    0x0000002d,0x0000002e,0x00000003,0x0004002b,0x00000013,0x0000002f,0x00000000,0x00040020,
+    0x00000030,0x00000001,0x00000007,0x00050036,0x00000002,0x00000004,0x00000000,0x00000003,
+    0x000200f8,0x00000005,0x0004003b,0x00000008,0x00000009,0x00000007,0x0004003b,0x00000019,
+    0x0000001a,0x00000007,0x0004003d,0x0000000b,0x0000000e,0x0000000d,0x00050041,0x00000015,
+    0x00000016,0x00000012,0x00000014,0x0004003d,0x0000000f,0x00000017,0x00000016,0x00050057,
+    0x00000007,0x00000018,0x0000000e,0x00000017,0x0003003e,0x00000009,0x00000018,0x00050041,
+    0x00000019,0x0000001d,0x00000009,0x0000001c,0x0004003d,0x00000006,0x0000001e,0x0000001d,
+    0x000400d1,0x00000006,0x0000001f,0x0000001e,0x0007000c,0x00000006,0x00000021,0x00000001,
+    0x00000028,0x0000001f,0x00000020,0x0003003e,0x0000001a,0x00000021,0x00050041,0x00000019,
+    0x00000022,0x00000009,0x0000001c,0x0004003d,0x00000006,0x00000023,0x00000022,0x00050083,
+    0x00000006,0x00000025,0x00000023,0x00000024,0x0004003d,0x00000006,0x00000026,0x0000001a,
+    0x00050088,0x00000006,0x00000027,0x00000025,0x00000026,0x00050081,0x00000006,0x00000028,
+    0x00000027,0x00000024,0x0008000c,0x00000006,0x0000002b,0x00000001,0x0000002b,0x00000028,
+    0x00000029,0x0000002a,0x00050041,0x00000019,0x0000002c,0x00000009,0x0000001c,0x0003003e,
+    0x0000002c,0x0000002b,0x00050041,0x00000030,0x00000031,0x00000012,0x0000002f,0x0004003d,
+    0x00000007,0x00000032,0x00000031,0x0004003d,0x00000007,0x00000033,0x00000009,0x00050085,
+    0x00000007,0x00000034,0x00000032,0x00000033,0x0003003e,0x0000002e,0x00000034,0x000100fd,
+    0x00010038
+};
+
 //-----------------------------------------------------------------------------
 // FUNCTIONS
 //-----------------------------------------------------------------------------
@@ -547,6 +616,7 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
 
     // Setup desired Vulkan state
     ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
+    VkPipeline bound_pipeline = pipeline;
 
     // Setup render state structure (for callbacks and custom texture bindings)
     ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
@@ -575,7 +645,10 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
+                    bound_pipeline = pipeline;
+                }
                 else
                     pcmd->UserCallback(draw_list, pcmd);
             }
@@ -602,7 +675,15 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                 vkCmdSetScissor(command_buffer, 0, 1, &scissor);
 
                 // Bind DescriptorSet with font or user texture
+                // (Font texture of an ImFontAtlasFlags_SDF atlas uses our SDF pipeline, unless a custom pipeline was passed to us.
+                //  Both pipelines share the same layout, so descriptor sets and push constants stay bound when switching.)
                 VkDescriptorSet desc_set = (VkDescriptorSet)pcmd->GetTexID();
+                VkPipeline cmd_pipeline = (bd->FontTextureIsSdf && desc_set == bd->FontTexture.DescriptorSet && pipeline == bd->Pipeline) ? bd->PipelineSdf : pipeline;
+                if (cmd_pipeline != bound_pipeline)
+                {
+                    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, cmd_pipeline);
+                    bound_pipeline = cmd_pipeline;
+                }
                 vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, &desc_set, 0, nullptr);
 
                 // Draw
@@ -669,10 +750,41 @@ bool ImGui_ImplVulkan_CreateFontsTexture()
         check_vk_result(err);
     }
 
+    // Select texture format
+    // - By default upload as RGBA 32-bit.
+    // - With ImFontAtlasFlags_TexFormatAlpha8 or ImFontAtlasFlags_TexFormatBC4, upload a single channel texture, expanded to (1,1,1,alpha) by the image view component mapping.
+    //   BC4 is used when the device supports sampling it with linear filtering (e.g. textureCompressionBC feature), otherwise we fall back to R8.
     unsigned char* pixels;
     int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
-    size_t upload_size = width * height * 4 * sizeof(char);
+    size_t upload_size;
+    VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    const bool use_alpha = (io.Fonts->Flags & (ImFontAtlasFlags_TexFormatAlpha8 | ImFontAtlasFlags_TexFormatBC4)) != 0 && !io.Fonts->TexPixelsUseColors;
+    bool use_bc4 = false;
+    if (use_alpha && (io.Fonts->Flags & ImFontAtlasFlags_TexFormatBC4))
+    {
+        VkFormatProperties format_properties;
+        vkGetPhysicalDeviceFormatProperties(v->PhysicalDevice, VK_FORMAT_BC4_UNORM_BLOCK, &format_properties);
+        const VkFormatFeatureFlags required_features = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+        use_bc4 = (format_properties.optimalTilingFeatures & required_features) == required_features;
+    }
+    if (use_bc4)
+    {
+        int bytes_per_page;
+        io.Fonts->GetTexDataAsBC4(&pixels, &width, &height, &bytes_per_page);
+        upload_size = (size_t)bytes_per_page;
+        format = VK_FORMAT_BC4_UNORM_BLOCK;
+    }
+    else if (use_alpha)
+    {
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
+        upload_size = (size_t)width * height;
+        format = VK_FORMAT_R8_UNORM;
+    }
+    else
+    {
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+        upload_size = (size_t)width * height * 4;
+    }
 
     // Create the Image:
     ImGui_ImplVulkan_Texture* backend_tex = &bd->FontTexture;
@@ -680,7 +792,7 @@ bool ImGui_ImplVulkan_CreateFontsTexture()
         VkImageCreateInfo info = {};
         info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
         info.imageType = VK_IMAGE_TYPE_2D;
-        info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        info.format = format;
         info.extent.width = width;
         info.extent.height = height;
         info.extent.depth = 1;
@@ -711,7 +823,14 @@ bool ImGui_ImplVulkan_CreateFontsTexture()
         info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
         info.image = backend_tex->Image;
         info.viewType = VK_IMAGE_VIEW_TYPE_2D;
-        info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        info.format = format;
+        if (format != VK_FORMAT_R8G8B8A8_UNORM)
+        {
+            info.components.r = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.g = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.b = VK_COMPONENT_SWIZZLE_ONE;
+            info.components.a = VK_COMPONENT_SWIZZLE_R;
+        }
         info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         info.subresourceRange.levelCount = 1;
         info.subresourceRange.layerCount = 1;
@@ -801,6 +920,7 @@ bool ImGui_ImplVulkan_CreateFontsTexture()
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)backend_tex->DescriptorSet);
+    bd->FontTextureIsSdf = (io.Fonts->Flags & ImFontAtlasFlags_SDF) != 0;
 
     // End command buffer
     VkSubmitInfo end_info = {};
@@ -863,9 +983,18 @@ static void ImGui_ImplVulkan_CreateShaderModules(VkDevice device, const VkAlloca
         VkResult err = vkCreateShaderModule(device, &frag_info, allocator, &bd->ShaderModuleFrag);
         check_vk_result(err);
     }
+    if (bd->ShaderModuleFragSdf == VK_NULL_HANDLE)
+    {
+        VkShaderModuleCreateInfo frag_info = {};
+        frag_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        frag_info.codeSize = sizeof(__glsl_shader_sdf_frag_spv);
+        frag_info.pCode = (uint32_t*)__glsl_shader_sdf_frag_spv;
+        VkResult err = vkCreateShaderModule(device, &frag_info, allocator, &bd->ShaderModuleFragSdf);
+        check_vk_result(err);
+    }
 }
 
-static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationCallbacks* allocator, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkSampleCountFlagBits MSAASamples, VkPipeline* pipeline, uint32_t subpass)
+static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationCallbacks* allocator, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkSampleCountFlagBits MSAASamples, VkPipeline* pipeline, uint32_t subpass, bool sdf = false)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_CreateShaderModules(device, allocator);
@@ -877,7 +1006,7 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     stage[0].pName = "main";
     stage[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     stage[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    stage[1].module = bd->ShaderModuleFrag;
+    stage[1].module = sdf ? bd->ShaderModuleFragSdf : bd->ShaderModuleFrag;
     stage[1].pName = "main";
 
     VkVertexInputBindingDescription binding_desc[1] = {};
@@ -1051,6 +1180,7 @@ bool ImGui_ImplVulkan_CreateDeviceObjects()
     }
 
     ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->Pipeline, v->Subpass);
+    ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->PipelineSdf, v->Subpass, true);
 
     return true;
 }
@@ -1067,9 +1197,11 @@ void    ImGui_ImplVulkan_DestroyDeviceObjects()
     if (bd->TexSampler)           { vkDestroySampler(v->Device, bd->TexSampler, v->Allocator); bd->TexSampler = VK_NULL_HANDLE; }
     if (bd->ShaderModuleVert)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleVert, v->Allocator); bd->ShaderModuleVert = VK_NULL_HANDLE; }
     if (bd->ShaderModuleFrag)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleFrag, v->Allocator); bd->ShaderModuleFrag = VK_NULL_HANDLE; }
+    if (bd->ShaderModuleFragSdf)  { vkDestroyShaderModule(v->Device, bd->ShaderModuleFragSdf, v->Allocator); bd->ShaderModuleFragSdf = VK_NULL_HANDLE; }
     if (bd->DescriptorSetLayout)  { vkDestroyDescriptorSetLayout(v->Device, bd->DescriptorSetLayout, v->Allocator); bd->DescriptorSetLayout = VK_NULL_HANDLE; }
     if (bd->PipelineLayout)       { vkDestroyPipelineLayout(v->Device, bd->PipelineLayout, v->Allocator); bd->PipelineLayout = VK_NULL_HANDLE; }
     if (bd->Pipeline)             { vkDestroyPipeline(v->Device, bd->Pipeline, v->Allocator); bd->Pipeline = VK_NULL_HANDLE; }
+    if (bd->PipelineSdf)          { vkDestroyPipeline(v->Device, bd->PipelineSdf, v->Allocator); bd->PipelineSdf = VK_NULL_HANDLE; }
     if (bd->DescriptorPool)       { vkDestroyDescriptorPool(v->Device, bd->DescriptorPool, v->Allocator); bd->DescriptorPool = VK_NULL_HANDLE; }
 }
 
@@ -1128,6 +1260,7 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info)
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_vulkan";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasSdfFonts;   // We can decode font atlases built with ImFontAtlasFlags_SDF.
 
     IM_ASSERT(info->Instance != VK_NULL_HANDLE);
     IM_ASSERT(info->PhysicalDevice != VK_NULL_HANDLE);
@@ -1158,7 +1291,7 @@ void ImGui_ImplVulkan_Shutdown()
     ImGui_ImplVulkan_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasSdfFonts);
     IM_DELETE(bd);
 }
 
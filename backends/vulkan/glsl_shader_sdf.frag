@@ -0,0 +1,18 @@
+#version 450 core
+layout(location = 0) out vec4 fColor;
+
+layout(set=0, binding=0) uniform sampler2D sTexture;
+
+layout(location = 0) in struct {
+    vec4 Color;
+    vec2 UV;
+} In;
+
+// Font atlas built with ImFontAtlasFlags_SDF: alpha holds a signed distance field, 0.5 on glyph edges.
+void main()
+{
+    vec4 tex = texture(sTexture, In.UV.st);
+    float w = max(fwidth(tex.a), 1.0 / 255.0);
+    tex.a = clamp((tex.a - 0.5) / w + 0.5, 0.0, 1.0);
+    fColor = In.Color * tex;
+}
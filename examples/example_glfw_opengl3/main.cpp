@@ -132,6 +132,16 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // When io.NextRefreshDelay > 0.0f nothing is animating: we may wait for new events (up to that delay) instead of polling, to skip idle frames.
+        // (gamepads are polled by the backend without emitting events, so we keep polling when gamepad navigation is enabled)
+#ifndef __EMSCRIPTEN__
+        const bool wait_events = (io.NextRefreshDelay > 0.0f) && !(io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad);
+        if (wait_events && io.NextRefreshDelay >= FLT_MAX)
+            glfwWaitEvents();
+        else if (wait_events)
+            glfwWaitEventsTimeout((double)io.NextRefreshDelay);
+        else
+#endif
         glfwPollEvents();
         if (glfwGetWindowAttrib(window, GLFW_ICONIFIED) != 0)
         {
@@ -0,0 +1,195 @@
+// dear imgui: "null" example application + loopback ImDrawData stream
+// (compile and link imgui + misc/drawstream, create context, run headless with scripted inputs, NO GRAPHICS OUTPUT)
+// Each frame is encoded with ImDrawStreamEncoder, as a headless server would do, then decoded with ImDrawStreamDecoder,
+// as a thin viewer would do. The decoded ImDrawData is checked against the original, and bandwidth/timings are reported.
+// Malformed packets (corrupted/truncated, and crafted out-of-range deltas) are then checked to be rejected without crashing.
+#include "imgui.h"
+#include "imgui_drawstream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+
+static double GetTimeInSeconds()
+{
+    using namespace std::chrono;
+    return duration_cast<duration<double>>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Compare decoded draw data with the original, allowing for quantization error
+static bool CompareDrawData(const ImDrawData* a, const ImDrawData* b, float pos_tolerance, float uv_tolerance)
+{
+    if (a->CmdLists.Size != b->CmdLists.Size || a->TotalVtxCount != b->TotalVtxCount || a->TotalIdxCount != b->TotalIdxCount)
+        return false;
+    for (int list_n = 0; list_n < a->CmdLists.Size; list_n++)
+    {
+        const ImDrawList* la = a->CmdLists[list_n];
+        const ImDrawList* lb = b->CmdLists[list_n];
+        if (la->VtxBuffer.Size != lb->VtxBuffer.Size || la->IdxBuffer.Size != lb->IdxBuffer.Size || la->CmdBuffer.Size != lb->CmdBuffer.Size)
+            return false;
+        for (int n = 0; n < la->VtxBuffer.Size; n++)
+        {
+            const ImDrawVert& va = la->VtxBuffer[n];
+            const ImDrawVert& vb = lb->VtxBuffer[n];
+            if (fabsf(va.pos.x - vb.pos.x) > pos_tolerance || fabsf(va.pos.y - vb.pos.y) > pos_tolerance || fabsf(va.uv.x - vb.uv.x) > uv_tolerance || fabsf(va.uv.y - vb.uv.y) > uv_tolerance || va.col != vb.col)
+                return false;
+        }
+        for (int n = 0; n < la->IdxBuffer.Size; n++)
+            if (la->IdxBuffer[n] != lb->IdxBuffer[n])
+                return false;
+        for (int n = 0; n < la->CmdBuffer.Size; n++)
+        {
+            const ImDrawCmd& ca = la->CmdBuffer[n];
+            const ImDrawCmd& cb = lb->CmdBuffer[n];
+            if (ca.TextureId != cb.TextureId || ca.VtxOffset != cb.VtxOffset || ca.IdxOffset != cb.IdxOffset || ca.ElemCount != cb.ElemCount)
+                return false;
+            if (fabsf(ca.ClipRect.x - cb.ClipRect.x) > pos_tolerance || fabsf(ca.ClipRect.y - cb.ClipRect.y) > pos_tolerance || fabsf(ca.ClipRect.z - cb.ClipRect.z) > pos_tolerance || fabsf(ca.ClipRect.w - cb.ClipRect.w) > pos_tolerance)
+                return false;
+        }
+    }
+    return true;
+}
+
+static unsigned char* WriteVarint(unsigned char* p, ImU64 v)
+{
+    for (; v >= 0x80; v >>= 7)
+        *p++ = (unsigned char)(v | 0x80);
+    *p++ = (unsigned char)v;
+    return p;
+}
+
+// Decode malformed packets: they must be rejected, or at least not crash (decoder bounds-checks everything).
+// 'keyframe' and 'delta' are two consecutive valid packets. Return number of errors.
+static int TestMalformedPackets(const ImVector<unsigned char>& keyframe, const ImVector<unsigned char>& delta)
+{
+    int errors = 0;
+    ImDrawStreamDecoder decoder;
+
+    // Crafted 'Delta' list whose prefix + suffix lengths overflow 64-bit (see stream format in imgui_drawstream.h)
+    if (!decoder.DecodeFrame(keyframe.Data, (size_t)keyframe.Size) || decoder.Lists.Size == 0)
+        return 1;
+    const ImU64 lengths[][3] = { { ~(ImU64)0, 1, 0 }, { 1, ~(ImU64)0, 0 }, { (ImU64)1 << 63, (ImU64)1 << 63, 0 }, { 0, 0, ~(ImU64)0 } };
+    for (const ImU64* l : lengths)
+    {
+        unsigned char buf[128];
+        unsigned char* p = buf;
+        *p++ = 1;                   // Version
+        p = WriteVarint(p, 0);      // Flags: not a keyframe
+        memset(p, 0, 6 * 4);        // DisplayPos, DisplaySize, FramebufferScale
+        p += 6 * 4;
+        p = WriteVarint(p, 1);      // Draw list count
+        p = WriteVarint(p, decoder.Lists[0]->Key);
+        *p++ = 1;                   // Mode: Delta
+        for (int n = 0; n < 3; n++)
+            p = WriteVarint(p, l[n]);
+        if (decoder.DecodeFrame(buf, (size_t)(p - buf)))
+        {
+            printf("Malformed delta packet was accepted!\n");
+            errors++;
+        }
+        decoder.DecodeFrame(keyframe.Data, (size_t)keyframe.Size);
+    }
+
+    // Corrupted and truncated packets
+    unsigned int seed = 1;
+    ImVector<unsigned char> corrupted;
+    for (int n = 0; n < 2000; n++)
+    {
+        const ImVector<unsigned char>& src = (n & 1) ? delta : keyframe;
+        corrupted = src;
+        for (int k = 0; k < 1 + (n % 4); k++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            corrupted[(seed >> 8) % (unsigned int)corrupted.Size] ^= (unsigned char)(1 + (seed >> 24) % 255);
+        }
+        if (n % 5 == 0)
+            corrupted.resize((int)((seed >> 4) % (unsigned int)corrupted.Size));
+        if (n & 1)
+            decoder.DecodeFrame(keyframe.Data, (size_t)keyframe.Size);
+        decoder.DecodeFrame(corrupted.Data, (size_t)corrupted.Size);
+    }
+    return errors;
+}
+
+int main(int, char**)
+{
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+
+    // Build atlas
+    // Texture identifiers are transmitted as-is: use an identifier which the viewer can map to its own copy of the font texture.
+    unsigned char* tex_pixels = nullptr;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    io.Fonts->SetTexID((ImTextureID)1);
+
+    ImDrawStreamEncoder encoder;
+    ImDrawStreamDecoder decoder;
+    ImVector<unsigned char> packet, keyframe_packet, delta_packet;
+    const float pos_tolerance = 0.5f / (1 << encoder.PosFracBits);
+    const float uv_tolerance = 0.5f / (1 << encoder.UvFracBits);
+
+    const int frame_count = 600;
+    double total_raw_bytes = 0.0, total_bytes = 0.0, total_encode_time = 0.0, total_decode_time = 0.0;
+    int max_bytes = 0, total_unchanged = 0, total_delta = 0, total_full = 0, errors = 0;
+    for (int n = 0; n < frame_count; n++)
+    {
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+
+        // Scripted inputs: mouse sweeps over the demo window for one second, then stays idle for two seconds
+        if ((n % 180) < 60)
+            io.AddMousePosEvent(80.0f + (n % 60) * 6.0f, 60.0f + (n % 60) * 4.0f);
+        if (n == 300)
+            encoder.Reset(); // e.g. a new viewer connected: send a keyframe
+
+        ImGui::NewFrame();
+        ImGui::ShowDemoWindow(nullptr);
+        ImGui::Begin("Stream");
+        ImGui::Text("Frame %d", n);
+        ImGui::End();
+        ImGui::Render();
+
+        // Loopback
+        packet.resize(0);
+        const double t0 = GetTimeInSeconds();
+        encoder.EncodeFrame(ImGui::GetDrawData(), &packet);
+        const double t1 = GetTimeInSeconds();
+        const bool decoded = decoder.DecodeFrame(packet.Data, (size_t)packet.Size);
+        const double t2 = GetTimeInSeconds();
+        if (!decoded || !CompareDrawData(ImGui::GetDrawData(), &decoder.DrawData, pos_tolerance, uv_tolerance))
+        {
+            printf("Frame %d: mismatch!\n", n);
+            errors++;
+        }
+
+        if (n == 0)
+            keyframe_packet = packet;
+        if (n == 1)
+            delta_packet = packet;
+
+        total_raw_bytes += encoder.StatsRawBytes;
+        total_bytes += packet.Size;
+        total_encode_time += t1 - t0;
+        total_decode_time += t2 - t1;
+        max_bytes = (packet.Size > max_bytes) ? packet.Size : max_bytes;
+        total_unchanged += encoder.StatsListsUnchanged;
+        total_delta += encoder.StatsListsDelta;
+        total_full += encoder.StatsListsFull;
+    }
+
+    errors += TestMalformedPackets(keyframe_packet, delta_packet);
+
+    printf("Frames: %d, errors: %d\n", frame_count, errors);
+    printf("Raw ImDrawData:  %8.0f bytes/frame (%.1f KB/s at 60 Hz)\n", total_raw_bytes / frame_count, total_raw_bytes / frame_count * 60.0 / 1024.0);
+    printf("Stream:          %8.0f bytes/frame (%.1f KB/s at 60 Hz), largest packet %d bytes, ratio %.1fx\n", total_bytes / frame_count, total_bytes / frame_count * 60.0 / 1024.0, max_bytes, total_raw_bytes / total_bytes);
+    printf("Draw lists:      %d unchanged, %d delta, %d full\n", total_unchanged, total_delta, total_full);
+    printf("Encode:          %8.1f us/frame\n", total_encode_time * 1e6 / frame_count);
+    printf("Decode:          %8.1f us/frame\n", total_decode_time * 1e6 / frame_count);
+
+    ImGui::DestroyContext();
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+// dear imgui: "null" example application + embedded fonts loading benchmark
+// (compile and link imgui, create context, run headless, NO GRAPHICS OUTPUT)
+// Measure the startup cost of loading fonts embedded in source code with misc/fonts/binary_to_compressed_c.cpp:
+// - For each compression format: stb_compress() (default) and LZ4 blocks (-lz4).
+// - For each source encoding: binary arrays (-u8/-u32) loaded with AddFontFromMemoryCompressedTTF(), and Base85 strings (-base85)
+//   loaded with AddFontFromMemoryCompressedBase85TTF().
+// The fonts in misc/fonts/ are compressed at startup with the same code as binary_to_compressed_c, instead of being embedded here.
+// Usage:
+//   example_null_fonts_benchmark [fonts_directory]
+#include "imgui.h"
+#include "imgui_internal.h" // ImFileLoadToMemory, ImFontDecompressGetBlockCount
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#define BINARY_TO_COMPRESSED_C_NO_MAIN
+#include "../../misc/fonts/binary_to_compressed_c.cpp"
+
+static const char* FontFilenames[] = { "ProggyClean.ttf", "ProggyTiny.ttf", "Karla-Regular.ttf", "Cousine-Regular.ttf", "DroidSans.ttf", "Roboto-Medium.ttf" };
+
+struct CompressedFont
+{
+    ImVector<char>  Data;       // Binary array, padded to a multiple of 4 bytes like binary_to_compressed_c output
+    ImVector<char>  Base85;     // Zero-terminated Base85 string
+};
+
+static void CompressFont(CompressedFont* out, const unsigned char* data, int data_size, Compression compression)
+{
+    const int max_size = ((compression == Compression_LZ4) ? lz4_blocks_compress_bound(data_size) : data_size + 512 + (data_size >> 2) + (int)sizeof(int)) + 4;
+    out->Data.resize(max_size);
+    memset(out->Data.Data, 0, (size_t)max_size);
+    int size = (compression == Compression_LZ4) ? lz4_blocks_compress((unsigned char*)out->Data.Data, data, data_size) : (int)stb_compress((stb_uchar*)out->Data.Data, (stb_uchar*)data, (stb_uint)data_size);
+    out->Data.resize(size);
+
+    out->Base85.resize(0);
+    for (int src_i = 0; src_i < size; src_i += 4)
+    {
+        unsigned int d = 0;
+        memcpy(&d, out->Data.Data + src_i, ImMin(size - src_i, 4));
+        for (int n5 = 0; n5 < 5; n5++, d /= 85)
+            out->Base85.push_back(Encode85Byte(d));
+    }
+    out->Base85.push_back(0);
+}
+
+// Return best time out of multiple runs, in milliseconds.
+// Each run uses a new atlas: the decompressed data is released with it, so it is not reused by the next run.
+template<typename T>
+static double MeasureLoadTime(T load_func, int runs)
+{
+    double best_ms = 1e9;
+    for (int n = 0; n < runs; n++)
+    {
+        ImFontAtlas atlas;
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        ImFont* font = load_func(&atlas);
+        std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+        IM_ASSERT(font != NULL);
+        IM_UNUSED(font);
+        best_ms = ImMin(best_ms, std::chrono::duration<double, std::milli>(t1 - t0).count());
+    }
+    return best_ms;
+}
+
+static bool CheckLoadedData(ImFont* (*load_func)(ImFontAtlas*, const CompressedFont&), const CompressedFont& compressed, const void* data, size_t data_size)
+{
+    ImFontAtlas atlas;
+    load_func(&atlas, compressed);
+    return atlas.ConfigData.Size == 1 && (size_t)atlas.ConfigData[0].FontDataSize == data_size && memcmp(atlas.ConfigData[0].FontData, data, data_size) == 0;
+}
+
+static ImFont* LoadCompressed(ImFontAtlas* atlas, const CompressedFont& font)    { return atlas->AddFontFromMemoryCompressedTTF(font.Data.Data, font.Data.Size, 16.0f); }
+static ImFont* LoadBase85(ImFontAtlas* atlas, const CompressedFont& font)        { return atlas->AddFontFromMemoryCompressedBase85TTF(font.Base85.Data, 16.0f); }
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    const char* fonts_dir = (argc >= 2) ? argv[1] : "../../misc/fonts";
+    const int runs = 50;
+
+    printf("Best of %d runs, decompression only (the font atlas is not built).\n", runs);
+    printf("%-20s %8s | %-27s | %-34s | %s\n", "", "", "stb_compress()", "LZ4 blocks (-lz4)", "Speedup");
+    printf("%-20s %8s | %8s %8s %9s | %8s %6s %8s %9s | %6s %6s\n", "File", "Size", "Size", "u8 ms", "base85 ms", "Size", "Blocks", "u8 ms", "base85 ms", "u8", "base85");
+
+    double total_stb_ms = 0.0, total_stb_b85_ms = 0.0, total_lz4_ms = 0.0, total_lz4_b85_ms = 0.0, total_build_ms = 0.0;
+    int errors = 0;
+    for (const char* font_filename : FontFilenames)
+    {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", fonts_dir, font_filename);
+        size_t data_size = 0;
+        void* data = ImFileLoadToMemory(path, "rb", &data_size);
+        if (data == NULL)
+        {
+            fprintf(stderr, "Could not load '%s'\n", path);
+            errors++;
+            continue;
+        }
+
+        CompressedFont stb, lz4;
+        CompressFont(&stb, (const unsigned char*)data, (int)data_size, Compression_Stb);
+        CompressFont(&lz4, (const unsigned char*)data, (int)data_size, Compression_LZ4);
+        const CompressedFont* compressed_fonts[] = { &stb, &lz4 };
+        for (const CompressedFont* compressed : compressed_fonts)
+            if (!CheckLoadedData(LoadCompressed, *compressed, data, data_size) || !CheckLoadedData(LoadBase85, *compressed, data, data_size))
+            {
+                fprintf(stderr, "Decompressed data mismatch for '%s' (%s)\n", path, compressed == &stb ? "stb_compress" : "lz4");
+                errors++;
+            }
+
+        const double stb_ms = MeasureLoadTime([&](ImFontAtlas* atlas) { return LoadCompressed(atlas, stb); }, runs);
+        const double stb_b85_ms = MeasureLoadTime([&](ImFontAtlas* atlas) { return LoadBase85(atlas, stb); }, runs);
+        const double lz4_ms = MeasureLoadTime([&](ImFontAtlas* atlas) { return LoadCompressed(atlas, lz4); }, runs);
+        const double lz4_b85_ms = MeasureLoadTime([&](ImFontAtlas* atlas) { return LoadBase85(atlas, lz4); }, runs);
+        const double build_ms = MeasureLoadTime([&](ImFontAtlas* atlas) { ImFont* font = LoadCompressed(atlas, lz4); atlas->Build(); return font; }, 5) - lz4_ms;
+        printf("%-20s %8d | %8d %8.3f %9.3f | %8d %6d %8.3f %9.3f | %5.1fx %5.1fx\n", font_filename, (int)data_size,
+            stb.Data.Size, stb_ms, stb_b85_ms,
+            lz4.Data.Size, ImFontDecompressGetBlockCount(lz4.Data.Data, (size_t)lz4.Data.Size), lz4_ms, lz4_b85_ms,
+            stb_ms / lz4_ms, stb_b85_ms / lz4_b85_ms);
+        total_stb_ms += stb_ms;
+        total_stb_b85_ms += stb_b85_ms;
+        total_lz4_ms += lz4_ms;
+        total_lz4_b85_ms += lz4_b85_ms;
+        total_build_ms += build_ms;
+        IM_FREE(data);
+    }
+    printf("%-20s %8s | %8s %8.3f %9.3f | %8s %6s %8.3f %9.3f | %5.1fx %5.1fx\n", "Total", "", "", total_stb_ms, total_stb_b85_ms, "", "", total_lz4_ms, total_lz4_b85_ms,
+        total_stb_ms / total_lz4_ms, total_stb_b85_ms / total_lz4_b85_ms);
+    printf("For reference, building the atlas for those fonts at 16 px takes %.3f ms.\n", total_build_ms);
+
+    ImGui::DestroyContext();
+    return errors ? 1 : 0;
+}
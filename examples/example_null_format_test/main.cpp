@@ -0,0 +1,190 @@
+// dear imgui: "null" example application + ImFormatString() conformance test
+// (compile and link imgui, run headless, NO GRAPHICS OUTPUT)
+// Compare the output of ImFormatString(), which handles common formats without calling vsnprintf(), with the output of vsnprintf():
+// - For each conversion handled by the fast path (%d %i %u %x %X %c %s %f) with flags, width, precision and length modifiers.
+// - For edge values (limits, rounding ties, negative zero, nan/inf) and for pseudo-random values.
+// - For truncated output (small buffers) and for size queries (NULL buffer).
+// Returns non-zero on any mismatch.
+// Usage:
+//   example_null_format_test [locale]      e.g. "de_DE.UTF-8" to check that %f falls back to vsnprintf() when the decimal point is not '.'
+//                                          (checks are run in the "C" locale first, then again after switching to this locale)
+#include "imgui.h"
+#include "imgui_internal.h" // ImFormatString
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <locale.h>
+#include <limits.h>
+#include <float.h>
+#include <math.h>
+
+static int g_ChecksCount = 0;
+static int g_ErrorsCount = 0;
+
+static void CheckV(size_t buf_size, const char* fmt, va_list args)
+{
+    char out[512], ref[512];
+    IM_ASSERT(buf_size <= sizeof(out));
+    va_list args_copy;
+    va_copy(args_copy, args);
+    const int ref_len = vsnprintf(ref, buf_size, fmt, args_copy);
+    va_end(args_copy);
+    va_copy(args_copy, args);
+    const int out_len = ImFormatStringV(out, buf_size, fmt, args_copy);
+    va_end(args_copy);
+    va_copy(args_copy, args);
+    const int out_size_query = ImFormatStringV(NULL, 0, fmt, args_copy);
+    va_end(args_copy);
+
+    // ImFormatString() returns the number of characters written (clamped to buf_size - 1), vsnprintf() returns the untruncated length.
+    const int ref_written = (ref_len < 0) ? -1 : ImMin(ref_len, (int)buf_size - 1);
+    g_ChecksCount++;
+    if (out_len != ref_written || out_size_query != ref_len || strcmp(out, ref) != 0)
+    {
+        fprintf(stderr, "Mismatch for \"%s\" (buf_size %d): got \"%s\" (%d, size query %d), expected \"%s\" (%d)\n", fmt, (int)buf_size, out, out_len, out_size_query, ref, ref_len);
+        g_ErrorsCount++;
+    }
+}
+
+static void Check(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    CheckV(512, fmt, args);
+    va_end(args);
+}
+
+static void CheckTruncated(size_t buf_size, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    CheckV(buf_size, fmt, args);
+    va_end(args);
+}
+
+// Deterministic pseudo-random generator (xorshift64), so runs are reproducible.
+static ImU64 g_RandomState = 0x9E3779B97F4A7C15ULL;
+static ImU64 Random()
+{
+    g_RandomState ^= g_RandomState << 13;
+    g_RandomState ^= g_RandomState >> 7;
+    g_RandomState ^= g_RandomState << 17;
+    return g_RandomState;
+}
+
+static const char* FloatFormats[] = { "%f", "%.0f", "%.1f", "%.2f", "%.3f", "%.4f", "%.6f", "%.9f", "%8.3f", "%-8.3f|", "%08.3f", "%+.3f", "% .3f", "%+08.2f", "%-+9.1f|", "%10f", "x=%.3f y=%.3f" };
+static const char* IntFormats[] = { "%d", "%i", "%5d", "%-5d|", "%05d", "%+d", "% d", "%+05d", "%-+6d|", "%0d", "%1d", "%20d" };
+static const char* UIntFormats[] = { "%u", "%x", "%X", "%08X", "0x%08x", "%-8x|", "%5u", "%012u" };
+
+static void RunChecks()
+{
+    // Literals, escapes and unsupported formats (falling back to vsnprintf)
+    Check("");
+    Check("Hello, world!");
+    Check("100%%");
+    Check("%% %d %%", 42);
+    Check("%g %e %p", 1.5, 2.5, (void*)&g_ChecksCount);
+    Check("%*d|%-*d|", 5, 42, 5, 42);
+    Check("%.12f", 3.14159265358979);
+
+    // Integers
+    const int int_values[] = { 0, 1, -1, 7, -7, 42, 100, -100, 12345, -12345, INT_MAX, INT_MIN, INT_MAX - 1, INT_MIN + 1 };
+    for (const char* fmt : IntFormats)
+        for (int v : int_values)
+            Check(fmt, v);
+    const unsigned int uint_values[] = { 0u, 1u, 9u, 10u, 15u, 16u, 255u, 256u, 0xDEADBEEFu, 0x7FFFFFFFu, 0x80000000u, UINT_MAX };
+    for (const char* fmt : UIntFormats)
+        for (unsigned int v : uint_values)
+            Check(fmt, v);
+    const long long ll_values[] = { 0, -1, LLONG_MAX, LLONG_MIN, 1234567890123LL, -1234567890123LL };
+    for (long long v : ll_values)
+    {
+        Check("%lld", v);
+        Check("%+20lld|%-20lli|", v, v);
+        Check("%llu", (unsigned long long)v);
+        Check("%016llX", (unsigned long long)v);
+        Check("%ld", (long)v);
+        Check("%lx", (unsigned long)v);
+    }
+
+    // Characters and strings
+    Check("%c%c%c", 'a', 'B', '9');
+    Check("[%3c] [%-3c]", 'x', 'y');
+    const char* str_values[] = { "", "a", "Hello", "Dear ImGui", "Some longer string with spaces" };
+    for (const char* v : str_values)
+    {
+        Check("%s", v);
+        Check("[%10s] [%-10s]", v, v);
+        Check("[%.3s] [%.0s] [%5.2s] [%-5.2s]", v, v, v, v);
+        Check("[%.*s]", 4, v);
+        Check("%s: %d", v, 42);
+    }
+
+    // Floats: edge values
+    const double double_values[] =
+    {
+        0.0, -0.0, 1.0, -1.0, 0.5, 1.5, 2.5, -2.5, 0.125, 0.375, 0.0625, 1.005, 2.675, 1e-10, -1e-10, 0.1, 0.2, 0.3, 1.0 / 3.0, 2.0 / 3.0,
+        123.456, -123.456, 999.9995, 9.9999999995, 99999.95, 1e9, 1e10, 1e15, 1e17, 1e18, 1e19, 1e20, 1e300, -1e300,
+        DBL_MIN, DBL_MAX, -DBL_MAX, DBL_EPSILON, 4294967296.5, 9007199254740993.0, (double)FLT_MAX, (double)FLT_MIN,
+        HUGE_VAL, -HUGE_VAL,
+    };
+    for (const char* fmt : FloatFormats)
+        for (double v : double_values)
+            Check(fmt, v, v);
+    Check("%f %.3f", (double)NAN, -(double)NAN);
+
+    // Floats: pseudo-random values, in various magnitude ranges, including exact rounding ties
+    for (int n = 0; n < 200000; n++)
+    {
+        const ImU64 r = Random();
+        double v;
+        switch (n % 4)
+        {
+        case 0: v = (double)(ImS64)(r >> 11) / (double)(1ULL << (r & 63)); break;        // Any magnitude
+        case 1: v = (double)(ImS64)(r >> 40) / 1000.0; break;                             // Typical UI values
+        case 2: v = (double)(ImS64)(r >> 44) / 1024.0; break;                             // Exact binary fractions (rounding ties)
+        default: { ImU64 bits = r & 0x7FEFFFFFFFFFFFFFULL; memcpy(&v, &bits, sizeof(v)); break; } // Random finite bit patterns
+        }
+        Check(FloatFormats[n % IM_ARRAYSIZE(FloatFormats)], v, -v);
+    }
+
+    // Pseudo-random integers
+    for (int n = 0; n < 100000; n++)
+    {
+        const ImU64 r = Random();
+        Check(IntFormats[n % IM_ARRAYSIZE(IntFormats)], (int)(ImU32)r);
+        Check(UIntFormats[n % IM_ARRAYSIZE(UIntFormats)], (unsigned int)(r >> 32));
+        Check("%lld %llx", (long long)r, (unsigned long long)r);
+    }
+
+    // Truncation
+    for (size_t buf_size = 1; buf_size < 24; buf_size++)
+    {
+        CheckTruncated(buf_size, "Hello, world!");
+        CheckTruncated(buf_size, "%d %s", -123456, "text");
+        CheckTruncated(buf_size, "%08X|%-6s|", 0xDEADBEEFu, "ab");
+        CheckTruncated(buf_size, "%.3f %.3f", 3.14159, -2.71828);
+        CheckTruncated(buf_size, "%10.4f%%", 1234.56789);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+
+    // Run in the default "C" locale first, then in the requested locale: the decimal point must not be cached.
+    RunChecks();
+    if (argc >= 2)
+    {
+        if (setlocale(LC_ALL, argv[1]) == NULL)
+        {
+            printf("Locale '%s' is not available, skipping.\n", argv[1]);
+            return (g_ErrorsCount > 0) ? 1 : 0;
+        }
+        printf("Locale '%s', decimal point '%s'.\n", argv[1], localeconv()->decimal_point);
+        RunChecks();
+    }
+
+    printf("%d checks, %d errors.\n", g_ChecksCount, g_ErrorsCount);
+    return (g_ErrorsCount > 0) ? 1 : 0;
+}
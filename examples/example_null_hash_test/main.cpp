@@ -0,0 +1,282 @@
+// dear imgui: "null" example application + compile-time hashing conformance test
+// (compile and link imgui, run headless, NO GRAPHICS OUTPUT)
+// Compare hashes of string literals computed at compile time (ImHashStrConstexpr(), IM_HASHED_STR(), IM_HASHED_LABEL()) with runtime hashing:
+// - static_assert() on known hashes, and on the handling of "##" and "###" in labels.
+// - For every widget label used by imgui_demo.cpp, for several seeds: ImHashStr(), ImHashData() and the ID stack (PushID(), GetID(), widgets).
+// Build it with and without SSE 4.2 (e.g. 'make WITH_SSE4_2=1'), and with IMGUI_USE_LEGACY_CRC32_ADLER ('make WITH_LEGACY_CRC32=1').
+// Returns non-zero on any mismatch.
+#include "imgui.h"
+#include "imgui_internal.h" // ImHashStr, ImHashData
+#include <stdio.h>
+#include <string.h>
+
+// Known hashes
+#ifdef IMGUI_USE_LEGACY_CRC32_ADLER
+static_assert(ImHashStrConstexpr("Hello, world!") == 0xEBE6C6E6, "CRC32 mismatch");
+static_assert(ImHashStrConstexpr("Settings") == 0x1C33C293, "CRC32 mismatch");
+static_assert(ImHashStrConstexpr("###ID") == 0x98C52B65, "CRC32 mismatch");
+#else
+static_assert(ImHashStrConstexpr("Hello, world!") == 0xC8A106E5, "CRC32c mismatch");
+static_assert(ImHashStrConstexpr("Settings") == 0xF9F8AA99, "CRC32c mismatch");
+static_assert(ImHashStrConstexpr("###ID") == 0x5FC4C22B, "CRC32c mismatch");
+#endif
+static_assert(ImHashStrConstexpr("") == 0, "Empty string with zero seed must hash to zero");
+static_assert(ImHashStrConstexpr("", 0x12345678) == 0x12345678, "Empty string must hash to the seed");
+
+// "##" is hashed with the rest of the label, "###" resets the hash to the seed
+static_assert(ImHashStrConstexpr("Label##A") != ImHashStrConstexpr("Label##B"), "'##' suffix must be hashed");
+static_assert(ImHashStrConstexpr("Label##A") != ImHashStrConstexpr("Label"), "'##' suffix must be hashed");
+static_assert(ImHashStrConstexpr("Label###ID") == ImHashStrConstexpr("###ID"), "'###' must reset the hash");
+static_assert(ImHashStrConstexpr("Other Label###ID", 42) == ImHashStrConstexpr("###ID", 42), "'###' must reset the hash to the seed");
+static_assert(ImHashStrConstexpr("A###B###C") == ImHashStrConstexpr("###C"), "Last '###' must reset the hash");
+static_assert(ImHashStrConstexpr("A####B") == ImHashStrConstexpr("####B"), "Last '###' must reset the hash");
+static_assert(ImConstU32<IM_HASHED_STR("Label###ID").Len>::Value == 5, "Hashed part must start at last '###'");
+static_assert(ImConstU32<IM_HASHED_STR("Label##ID").Len>::Value == 9, "Hashed part must include '##'");
+
+// Widget labels used by imgui_demo.cpp
+#define DEMO_LABELS(X) \
+    X("Dear ImGui Style Editor") X("Dear ImGui Demo") X("Help") X("Configuration") X("Configuration##2") X("io.ConfigFlags: NavEnableKeyboard") \
+    X("io.ConfigFlags: NavEnableGamepad") X("io.ConfigFlags: NoMouse") X("io.ConfigFlags: NoMouseCursorChange") X("io.ConfigFlags: NoKeyboard") \
+    X("io.ConfigInputTrickleEventQueue") X("io.MouseDrawCursor") X("io.ConfigNavSwapGamepadButtons") X("io.ConfigNavMoveSetMousePos") \
+    X("io.ConfigNavCaptureKeyboard") X("io.ConfigNavEscapeClearFocusItem") X("io.ConfigNavEscapeClearFocusWindow") X("io.ConfigNavCursorVisibleAuto") \
+    X("io.ConfigNavCursorVisibleAlways") X("io.ConfigWindowsResizeFromEdges") X("io.ConfigWindowsMoveFromTitleBarOnly") \
+    X("io.ConfigWindowsCopyContentsWithCtrlC") X("io.ConfigScrollbarScrollByPage") X("io.ConfigInputTextCursorBlink") \
+    X("io.ConfigInputTextEnterKeepActive") X("io.ConfigDragClickToInputText") X("io.ConfigMacOSXBehaviors") X("io.ConfigErrorRecovery") \
+    X("io.ConfigErrorRecoveryEnableAssert") X("io.ConfigErrorRecoveryEnableDebugLog") X("io.ConfigErrorRecoveryEnableTooltip") \
+    X("io.ConfigDebugIsDebuggerPresent") X("io.ConfigDebugHighlightIdConflicts") X("io.ConfigDebugBeginReturnValueOnce") \
+    X("io.ConfigDebugBeginReturnValueLoop") X("io.ConfigDebugIgnoreFocusLoss") X("io.ConfigDebugIniSettings") X("Backend Flags") \
+    X("io.BackendFlags: HasGamepad") X("io.BackendFlags: HasMouseCursors") X("io.BackendFlags: HasSetMousePos") \
+    X("io.BackendFlags: RendererHasVtxOffset") X("io.BackendFlags: RendererHasSdfFonts") X("io.BackendFlags: RendererHasTexPages") X("Style") \
+    X("Style Editor") X("Capture/Logging") X("Copy \"Hello, world!\" to clipboard") X("Window options") X("split") X("No titlebar") X("No scrollbar") \
+    X("No menu") X("No move") X("No resize") X("No collapse") X("No close") X("No nav") X("No background") X("No bring to front") \
+    X("Unsaved document") X("Menu") X("Examples") X("Main menu bar") X("Assets Browser") X("Console") X("Custom rendering") X("Documents") X("Log") \
+    X("Property editor") X("Simple layout") X("Simple overlay") X("Auto-resizing window") X("Constrained-resizing window") X("Fullscreen window") \
+    X("Long text display") X("Manipulating window titles") X("MenuItem") X("Tools") X("Metrics/Debugger") X("Debug Log") X("ID Stack Tool") \
+    X("Item Picker") X("About Dear ImGui") X("Highlight ID Conflicts") X("Widgets") X("Basic") X("Button") X("checkbox") X("radio a") X("radio b") \
+    X("radio c") X("Click") X("##left") X("##right") X("Tooltip") X("input text") X("input int") X("input float") X("input scientific") X("drag int") \
+    X("drag int 0..100") X("drag int wrap 100..200") X("drag float") X("drag small float") X("drag wrap -1..1") X("slider int") X("slider float") \
+    X("slider float (log)") X("slider angle") X("slider enum") X("color 1") X("color 2") X("combo") X("listbox") X("Tooltips") X("Fancy") X("Curve") \
+    X("Off") X("Always On (Simple)") X("Always On (Advanced)") X("Manual") X("DelayNone") X("DelayShort") X("DelayLong") X("Stationary") \
+    X("Disabled item") X("Tree Nodes") X("Basic trees") X("") X("button") X("Advanced, with Selectable nodes") X("ImGuiTreeNodeFlags_OpenOnArrow") \
+    X("ImGuiTreeNodeFlags_OpenOnDoubleClick") X("ImGuiTreeNodeFlags_SpanAvailWidth") X("ImGuiTreeNodeFlags_SpanFullWidth") \
+    X("ImGuiTreeNodeFlags_SpanTextWidth") X("ImGuiTreeNodeFlags_SpanAllColumns") X("ImGuiTreeNodeFlags_AllowOverlap") X("ImGuiTreeNodeFlags_Framed") \
+    X("ImGuiTreeNodeFlags_NavLeftJumpsBackHere") X("Align label with current X position") X("Test tree node as drag source") X("Collapsing Headers") \
+    X("Show 2nd header") X("Header") X("Header with a close button") X("Header with a bullet") X("Bullets") X("Tree node") X("Text") \
+    X("Colorful Text") X("Word Wrapping") X("Wrap width") X("UTF-8 Text") X("UTF-8 input") X("Images") X("Use Text Color for Tint") X("Combo") \
+    X("ImGuiComboFlags_PopupAlignLeft") X("ImGuiComboFlags_NoArrowButton") X("ImGuiComboFlags_NoPreview") X("ImGuiComboFlags_WidthFitPreview") \
+    X("ImGuiComboFlags_HeightSmall") X("ImGuiComboFlags_HeightRegular") X("ImGuiComboFlags_HeightLargest") X("combo 1") X("combo 2 (one-liner)") \
+    X("combo 3 (array)") X("combo 4 (function)") X("List boxes") X("Highlight hovered item in second listbox") X("listbox 1") X("##listbox 2") \
+    X("Selectables") X("1. I am selectable") X("2. I am selectable") X("3. I am selectable") X("4. I am double clickable") \
+    X("Rendering more items on the same line") X("main.c") X("Link 1") X("Hello.cpp") X("Link 2") X("Hello.h") X("Link 3") X("In Tables") X("split1") \
+    X("split2") X("Grid") X("Sailor") X("Alignment") X("Text Input") X("Multi-line Text Input") X("ImGuiInputTextFlags_ReadOnly") \
+    X("ImGuiInputTextFlags_AllowTabInput") X("ImGuiInputTextFlags_CtrlEnterForNewLine") X("##source") X("Filtered Text Input") X("default") \
+    X("decimal") X("hexadecimal") X("uppercase") X("no blank") X("casing swap") X("\"imgui\"") X("Password Input") X("password") X("password (clear)") \
+    X("Completion, History, Edit Callbacks") X("Completion") X("History") X("Edit") X("Resize Callback") X("Eliding, Alignment") \
+    X("ImGuiInputTextFlags_ElideLeft") X("Path") X("Miscellaneous") X("ImGuiInputTextFlags_EscapeClearsAll") X("ImGuiInputTextFlags_NoUndoRedo") \
+    X("Hello") X("Tabs") X("MyTabBar") X("Avocado") X("Broccoli") X("Cucumber") X("Advanced & Close Button") X("ImGuiTabBarFlags_Reorderable") \
+    X("ImGuiTabBarFlags_AutoSelectNewTabs") X("ImGuiTabBarFlags_TabListPopupButton") X("ImGuiTabBarFlags_NoCloseWithMiddleMouseButton") \
+    X("ImGuiTabBarFlags_DrawSelectedOverline") X("ImGuiTabBarFlags_FittingPolicyResizeDown") X("ImGuiTabBarFlags_FittingPolicyScroll") \
+    X("TabItemButton & Leading/Trailing flags") X("Show Leading TabItemButton()") X("Show Trailing TabItemButton()") X("MyHelpMenu") X("Hello!") \
+    X("Plotting") X("Animate") X("Frame Times") X("Histogram") X("Lines") X("func") X("Sample count") X("Lines##2") X("Histogram##2") \
+    X("Progress Bars") X("Color/Picker Widgets") X("With Alpha Preview") X("With Half Alpha Preview") X("With Drag and Drop") X("With Options Menu") \
+    X("With HDR") X("MyColor##1") X("MyColor##2") X("MyColor##2f") X("MyColor##3") X("Palette") X("mypicker") X("ImGuiColorEditFlags_NoBorder") \
+    X("With Alpha") X("With Alpha Bar") X("With Side Preview") X("With Ref Color") X("##RefColor") X("Display Mode") \
+    X("Default: Uint8 + HSV + Hue Bar") X("Default: Float + HDR + Hue Wheel") X("HSV shown as RGB##1") X("HSV shown as HSV##1") X("Drag/Slider Flags") \
+    X("ImGuiSliderFlags_AlwaysClamp") X("ImGuiSliderFlags_ClampOnInput") X("ImGuiSliderFlags_ClampZeroRange") X("ImGuiSliderFlags_Logarithmic") \
+    X("ImGuiSliderFlags_NoRoundToFormat") X("ImGuiSliderFlags_NoInput") X("ImGuiSliderFlags_NoSpeedTweaks") X("ImGuiSliderFlags_WrapAround") \
+    X("DragFloat (0 -> 1)") X("DragFloat (0 -> +inf)") X("DragFloat (-inf -> 1)") X("DragFloat (-inf -> +inf)") X("DragFloat (0 -> 0)") \
+    X("DragFloat (100 -> 100)") X("DragInt (0 -> 100)") X("SliderFloat (0 -> 1)") X("SliderInt (0 -> 100)") X("Range Widgets") X("Data Types") \
+    X("Clamp integers to 0..50") X("Show step buttons") X("ImGuiInputTextFlags_ParseEmptyRefVal") X("ImGuiInputTextFlags_DisplayEmptyRefVal") \
+    X("Multi-component Widgets") X("Vertical Sliders") X("set1") X("##v") X("set2") X("set3") X("Drag and Drop") \
+    X("Drag and drop in standard widgets") X("Drag and drop to copy/swap items") X("Copy") X("Move") X("Swap") X("Drag to reorder items (simple)") \
+    X("Tooltip at target location") X("Querying Item Status (Edited/Active/Hovered etc.)") X("Item Type") X("Item Disabled") X("ITEM: Button") \
+    X("ITEM: Checkbox") X("ITEM: SliderFloat") X("ITEM: InputText") X("ITEM: InputTextMultiline") X("ITEM: InputFloat") X("ITEM: ColorEdit4") \
+    X("ITEM: Selectable") X("ITEM: MenuItem") X("ITEM: TreeNode") X("ITEM: TreeNode w/ ImGuiTreeNodeFlags_OpenOnDoubleClick") X("ITEM: Combo") \
+    X("ITEM: ListBox") X("unused") X("Querying Window Status (Focused/Hovered etc.)") \
+    X("Embed everything inside a child window for testing _RootWindow flag.") X("outer_child") X("child") \
+    X("Hovered/Active tests after Begin() for title bar testing") X("Title bar Hovered/Active tests") X("Close") X("Disable block") \
+    X("Disable entire section above") X("Text Filter") X("Sorted") X("0") X("1") X(">>") X(">") X("<") X("<<") X("MoveUp") X("MoveDown") \
+    X("Selection State & Multi-Select") X("Single-Select") X("Multi-Select (manual/simplified, without BeginMultiSelect)") X("Multi-Select") \
+    X("##Basket") X("Multi-Select (with clipper)") X("Multi-Select (grid, with range storage)") X("##Grid") X("Multi-Select (with deletion)") \
+    X("Add 20 items") X("Remove 20 items") X("Multi-Select (dual list box)") X("Multi-Select (in a table)") X("hello") X("Multi-Select (checkboxes)") \
+    X("ImGuiMultiSelectFlags_NoAutoSelect") X("ImGuiMultiSelectFlags_NoAutoClear") X("ImGuiMultiSelectFlags_BoxSelect2d") \
+    X("Multi-Select (multiple scopes)") X("ImGuiMultiSelectFlags_ScopeWindow") X("ImGuiMultiSelectFlags_ScopeRect") \
+    X("ImGuiMultiSelectFlags_ClearOnClickVoid") X("ImGuiMultiSelectFlags_BoxSelect1d") X("Multi-Select (tiled assets browser)") \
+    X("Multi-Select (trees)") X("##Tree") X("Multi-Select (advanced)") X("Options") X("Tree nodes") X("Enable clipper") X("Enable deletion") \
+    X("Enable drag & drop") X("Show in a table") X("Show color button") X("ImGuiMultiSelectFlags_SingleSelect") X("ImGuiMultiSelectFlags_NoSelectAll") \
+    X("ImGuiMultiSelectFlags_NoRangeSelect") X("ImGuiMultiSelectFlags_NoAutoClearOnReselect") X("ImGuiMultiSelectFlags_BoxSelectNoScroll") \
+    X("ImGuiMultiSelectFlags_ClearOnEscape") X("ImGuiMultiSelectFlags_SelectOnClick") X("ImGuiMultiSelectFlags_SelectOnClickRelease") X("##Split") \
+    X("###NoLabel") X("Layout & Scrolling") X("Child windows") X("Disable Mouse Wheel") X("Disable Menu") X("ChildL") X("ChildR") \
+    X("Set Height to 200") X("ResizableChild") X("Lines Count") X("Max Height (in Lines)") X("ConstrainedChild") X("Offset X") \
+    X("Override ChildBg color") X("ImGuiChildFlags_Borders") X("ImGuiChildFlags_AlwaysUseWindowPadding") X("ImGuiChildFlags_ResizeX") \
+    X("ImGuiChildFlags_ResizeY") X("ImGuiChildFlags_FrameStyle") X("Red") X("Widgets Width") X("Show indented items") X("float##1b") \
+    X("float (indented)##1b") X("float##2a") X("float (indented)##2b") X("float##3a") X("float (indented)##3b") X("float##4a") \
+    X("float (indented)##4b") X("##float5a") X("float (indented)##5b") X("Basic Horizontal Layout") X("Banana") X("Apple") X("Corniflower") \
+    X("Like this one") X("x=150") X("x=300") X("My") X("Tailor") X("Is") X("Rich") X("X") X("Y") X("Z") X("A") X("B") X("Box") X("Groups") X("AAA") \
+    X("BBB") X("CCC") X("DDD") X("EEE") X("##values") X("ACTION") X("REACTION") X("LEVERAGE\nBUZZWORD") X("List") X("Selected") X("Not Selected") \
+    X("Text Baseline Alignment") X("Some framed item") X("Some framed item##2") X("TEST##1") X("TEST##2") X("Item##1") X("Item##2") X("Item##3") \
+    X("HOP##1") X("HOP##2") X("80x80") X("50x50") X("Button()") X("SmallButton()") X("Button##1") X("Node##1") X("Node##2") X("Button##2") \
+    X("Button##3") X("Button##4") X("Scrolling") X("Decoration") X("Track") X("##item") X("Scroll Offset") X("##off") X("Scroll To Pos") X("##pos") \
+    X("##VerticalScrolling") X("##HorizontalScrolling") X("scrolling") X("Show Horizontal contents size demo window") \
+    X("Horizontal contents size demo window") X("H-scrollbar") X("Text wrapped") X("Columns") X("Tab bar") X("Child") X("Explicit content size") \
+    X("##csx") X("this is a 300-wide button") X("this is a tree node") X("another one of those tree node...") X("CollapsingHeader") X("table") \
+    X("OneOneOne") X("TwoTwoTwo") X("ThreeThreeThree") X("FourFourFour") X("Text Clipping") X("##canvas") X("Overlap Mode") X("Enable AllowOverlap") \
+    X("Button 1") X("Button 2") X("Some Selectable") X("++") X("Popups & Modal windows") X("Open") X("MyPopup") X("Popups") X("Select..") \
+    X("my_select_popup") X("Toggle..") X("my_toggle_popup") X("Sub-menu") X("Click me") X("Stacked Popup") X("another popup") X("With a menu..") \
+    X("my_file_popup") X("File") X("Dummy") X("This is a dummy button..") X("Context menus") X("Set to zero") X("Set to PI") X("##Value") \
+    X("(3) Or click this button") X("my popup") X("##edit") X("Modals") X("Delete..") X("Delete?") X("Don't ask me next time") X("OK") X("Cancel") \
+    X("Stacked modals..") X("Stacked 1") X("Some menu item") X("Color") X("Add another modal..") X("Stacked 2") X("Menus inside a regular window") \
+    X("Menu item") X("Menu inside a regular window") X("Sizing Policy") X("_Disabled") X("_DefaultHide") X("_DefaultSort") X("_WidthStretch") \
+    X("_WidthFixed") X("_NoResize") X("_NoReorder") X("_NoHide") X("_NoClip") X("_NoSort") X("_NoSortAscending") X("_NoSortDescending") \
+    X("_NoHeaderLabel") X("_NoHeaderWidth") X("_PreferSortAscending") X("_PreferSortDescending") X("_IndentEnable") X("_IndentDisable") \
+    X("_AngledHeader") X("_IsEnabled") X("_IsVisible") X("_IsSorted") X("_IsHovered") X("Tables & Columns") X("Tables") X("Expand all") \
+    X("Collapse all") X("Disable tree indentation") X("table1") X("table2") X("table3") X("Borders, background") X("ImGuiTableFlags_RowBg") \
+    X("ImGuiTableFlags_Borders") X("ImGuiTableFlags_BordersH") X("ImGuiTableFlags_BordersOuterH") X("ImGuiTableFlags_BordersInnerH") \
+    X("ImGuiTableFlags_BordersV") X("ImGuiTableFlags_BordersOuterV") X("ImGuiTableFlags_BordersInnerV") X("ImGuiTableFlags_BordersOuter") \
+    X("ImGuiTableFlags_BordersInner") X("FillButton") X("Display headers") X("ImGuiTableFlags_NoBordersInBody") X("Resizable, stretch") \
+    X("ImGuiTableFlags_Resizable") X("Resizable, fixed") X("ImGuiTableFlags_NoHostExtendX") X("Resizable, mixed") \
+    X("Reorderable, hideable, with headers") X("ImGuiTableFlags_Reorderable") X("ImGuiTableFlags_Hideable") \
+    X("ImGuiTableFlags_NoBordersInBodyUntilResize") X("ImGuiTableFlags_HighlightHoveredColumn") X("Padding") X("ImGuiTableFlags_PadOuterX") \
+    X("ImGuiTableFlags_NoPadOuterX") X("ImGuiTableFlags_NoPadInnerX") X("show_headers") X("table_padding") X("show_widget_frame_bg") \
+    X("table_padding_2") X("##cell") X("Sizing policies") X("Advanced") X("Contents") X("ImGuiTableFlags_PreciseWidths") X("ImGuiTableFlags_ScrollX") \
+    X("ImGuiTableFlags_ScrollY") X("ImGuiTableFlags_NoClip") X("##") X("Vertical scrolling, with clipping") X("table_scrolly") \
+    X("Horizontal scrolling") X("freeze_cols") X("freeze_rows") X("table_scrollx") X("flags3") X("inner_width") X("Columns flags") \
+    X("table_columns_flags_checkboxes") X("table_columns_flags") X("Columns widths") X("ImGuiTableFlags_NoKeepColumnsVisible") X("Nested tables") \
+    X("table_nested1") X("table_nested2") X("Row height") X("table_row_height") X("table_share_lineheight") X("table_changing_cellpadding_y") \
+    X("Outer size") X("ImGuiTableFlags_NoHostExtendY") X("Background color") X("row bg type") X("row bg target") X("cell bg type") X("Tree view") \
+    X("3ways") X("Item width") X("table_item_width") X("float0") X("float1") X("##float2") X("Custom headers") X("table_custom_headers") \
+    X("##checkall") X("Angled headers") X("_ScrollX") X("_ScrollY") X("_Resizable") X("_Sortable") X("_NoBordersInBody") X("_HighlightHoveredColumn") \
+    X("Frozen columns") X("Frozen rows") X("Disable header contributing to column width") X("Style settings") X("style.TableAngledHeadersAngle") \
+    X("table_angled_headers") X("ImGuiTableFlags_ContextMenuInBody") X("table_context_menu") X("table_context_menu_2") X("..") X("Synced instances") \
+    X("ImGuiTableFlags_SizingFixedFit") X("Table") X("Sorting") X("ImGuiTableFlags_SortMulti") X("ImGuiTableFlags_SortTristate") X("table_sorting") \
+    X("None") X("Features:") X("ImGuiTableFlags_Sortable") X("ImGuiTableFlags_NoSavedSettings") X("Decorations:") X("Sizing:") X("Padding:") \
+    X("Scrolling:") X("Sorting:") X("Headers:") X("ImGuiTableColumnFlags_AngledHeader") X("Other:") X("show_wrapped_text") X("outer_size") \
+    X("inner_width (when ScrollX active)") X("row_min_height") X("items_count") X("items_type (first column)") X("table_advanced") X("Chop") X("Eat") \
+    X("Debug details") X("Legacy Columns API") X("Borders") X("##columns_count") X("horizontal") X("vertical") X("Mixed items") X("red") X("blue") \
+    X("Category A") X("Category B") X("Category C") X("Word-wrapping") X("Horizontal Scrolling") X("##ScrollingRegion") X("Tree") X("Tree in column") \
+    X("Inputs & Focus") X("Inputs") X("Outputs") X("WantCapture override") X("SetNextFrameWantCaptureMouse() on hover") \
+    X("SetNextFrameWantCaptureKeyboard() on hover") X("Shortcuts") X("ImGuiInputFlags_Repeat") X("ImGuiInputFlags_RouteActive") \
+    X("ImGuiInputFlags_RouteFocused (default)") X("ImGuiInputFlags_RouteGlobal") X("ImGuiInputFlags_RouteOverFocused") \
+    X("ImGuiInputFlags_RouteOverActive") X("ImGuiInputFlags_RouteUnlessBgFocused") X("ImGuiInputFlags_RouteAlways") X("Save") X("Factor") X("WindowA") \
+    X("InputTextB") X("ChildD") X("ChildE") X("Open Popup") X("PopupF") X("InputTextG") X("Mouse Cursors") X("Tabbing") X("2") X("3") \
+    X("4 (tab skip)") X("5") X("Focus from code") X("Focus on 1") X("Focus on 2") X("Focus on 3") X("3 (tab skip)") X("Focus on X") X("Focus on Y") \
+    X("Focus on Z") X("Dragging") X("Drag Me") X("Config/Build Information") X("Copy to clipboard") X("cfg_infos") X("FrameRounding") \
+    X("WindowBorder") X("FrameBorder") X("PopupBorder") X("Save Ref") X("Revert Ref") X("##tabs") X("Sizes") X("IndentSpacing") X("ScrollbarSize") \
+    X("GrabMinSize") X("WindowBorderSize") X("ChildBorderSize") X("PopupBorderSize") X("FrameBorderSize") X("TabBorderSize") X("TabBarBorderSize") \
+    X("TabBarOverlineSize") X("WindowRounding") X("ChildRounding") X("PopupRounding") X("ScrollbarRounding") X("GrabRounding") X("TabRounding") \
+    X("TableAngledHeadersAngle") X("WindowMenuButtonPosition") X("ColorButtonPosition") X("SeparatorTextBorderSize") X("LogSliderDeadzone") \
+    X("ImGuiHoveredFlags_DelayNone") X("ImGuiHoveredFlags_DelayShort") X("ImGuiHoveredFlags_DelayNormal") X("ImGuiHoveredFlags_Stationary") \
+    X("ImGuiHoveredFlags_NoSharedDelay") X("Colors") X("Export") X("##output_type") X("Only Modified Colors") X("Opaque") X("Alpha") X("Both") \
+    X("##colors") X("?") X("##color") X("Revert") X("Fonts") X("window scale") X("global scale") X("Rendering") X("Anti-aliased lines") \
+    X("Anti-aliased lines use texture") X("Anti-aliased fill") X("Curve Tessellation Tolerance") X("Circle Tessellation Max Error") X("Global Alpha") \
+    X("Disabled Alpha") X("Undo") X("Redo") X("Cut") X("Paste") X("(demo menu)") X("New") X("Open Recent") X("fish_hat.c") X("fish_hat.inl") \
+    X("fish_hat.h") X("More..") X("Recurse..") X("Save As..") X("Enabled") X("Value") X("Input") X("SomeOption") X("Disabled") X("Checked") X("Quit") \
+    X("Close Console") X("Add Debug Text") X("Add Debug Error") X("Clear") X("Auto-scroll") X("ScrollingRegion") X("Example: Log") \
+    X("[Debug] Add 5 entries") X("Example: Simple layout") X("left pane") X("item view") X("##Tabs") X("Description") X("Details") X("##tree") \
+    X("##bg") X("##properties") X("##Editor") X("Example: Property editor") X("Example: Long text display") X("Test type") X("Add 1000 lines") \
+    X("Example: Auto-resizing window") X("Number of lines") X("Example: Constrained Resize") X("Set 200x200") X("Set 500x500") X("Set 800x200") \
+    X("Constraint") X("Auto-resize") X("Window padding") X("Example: Simple overlay") X("Custom") X("Center") X("Top-left") X("Top-right") \
+    X("Bottom-left") X("Bottom-right") X("Example: Fullscreen window") X("Use work area instead of main area") X("ImGuiWindowFlags_NoBackground") \
+    X("ImGuiWindowFlags_NoDecoration") X("ImGuiWindowFlags_NoTitleBar") X("ImGuiWindowFlags_NoCollapse") X("ImGuiWindowFlags_NoScrollbar") \
+    X("Close this window") X("Same title as another window##1") X("Same title as another window##2") X("Example: Custom rendering") X("##TabBar") \
+    X("Primitives") X("##gradient1") X("##gradient2") X("Size") X("Thickness") X("N-gon sides") X("##circlesegmentoverride") \
+    X("Circle segments override") X("##curvessegmentoverride") X("Curves segments override") X("Canvas") X("Enable grid") X("Enable context menu") \
+    X("canvas") X("context") X("Remove one") X("Remove all") X("BG/FG draw lists") X("Draw in Background draw list") X("Draw in Foreground draw list") \
+    X("Draw Channels") X("Rename..") X("Modify") X("color") X("Rename...") X("Example: Documents") X("Close All Documents") X("Exit") X("Rename") \
+    X("###Name") X("Save?") X("frame") X("Yes") X("No") X("Add 10000 items") X("Clear items") X("Delete") X("Show Type Overlay") X("Allow Sorting") \
+    X("Allow dragging unselected item") X("Allow box-selection") X("Icon Size") X("Icon Spacing") X("Icon Hit Spacing") X("Stretch Spacing") \
+    X("for_sort_specs_only") X("Assets")
+
+struct LabelInfo
+{
+    const char*     Label;
+    ImGuiHashedStr  Hashed;
+    ImGuiID         ConstexprHash;  // With a zero seed
+};
+#define DEMO_LABEL_INFO(_LITERAL) { _LITERAL, IM_HASHED_STR(_LITERAL), ImConstU32<ImHashStrConstexpr(_LITERAL)>::Value },
+static const LabelInfo DemoLabels[] = { DEMO_LABELS(DEMO_LABEL_INFO) };
+
+static int g_ChecksCount = 0;
+static int g_ErrorsCount = 0;
+
+static void Check(bool ok, const char* what, const char* label, ImGuiID seed)
+{
+    g_ChecksCount++;
+    if (ok)
+        return;
+    fprintf(stderr, "Mismatch for \"%s\" (seed %08X): %s\n", label, seed, what);
+    g_ErrorsCount++;
+}
+
+int main(int, char**)
+{
+    IMGUI_CHECKVERSION();
+#if defined(IMGUI_ENABLE_SSE4_2_CRC)
+    printf("Hash: CRC32c, SSE 4.2.\n");
+#elif defined(IMGUI_USE_LEGACY_CRC32_ADLER)
+    printf("Hash: legacy CRC32.\n");
+#else
+    printf("Hash: CRC32c, lookup table.\n");
+#endif
+
+    // Hash functions
+    const ImGuiID seeds[] = { 0, 1, 0x12345678, 0xFFFFFFFF, ImHashStr("Dear ImGui Demo") };
+    for (const LabelInfo& info : DemoLabels)
+    {
+        const char* label = info.Label;
+        const char* hashed_part = strstr(label, "###") ? label : NULL; // Part of the label after the last "###"
+        for (const char* p = label; (p = strstr(p, "###")) != NULL; p++)
+            hashed_part = p;
+        if (hashed_part == NULL)
+            hashed_part = label;
+        Check(info.ConstexprHash == ImHashStr(label), "ImHashStrConstexpr() at compile time", label, 0);
+        Check(info.Hashed.Len == strlen(hashed_part), "IM_HASHED_STR() length", label, 0);
+        for (ImGuiID seed : seeds)
+        {
+            const ImGuiID id = ImHashStr(label, 0, seed);
+            Check(ImHashStr(label, strlen(label), seed) == id, "ImHashStr() with size", label, seed);
+            Check(ImHashData(hashed_part, strlen(hashed_part), seed) == id, "ImHashData()", label, seed);
+            Check(ImHashStrConstexpr(label, seed) == id, "ImHashStrConstexpr()", label, seed);
+            Check(ImHashStr(info.Hashed, seed) == id, "ImHashStr(IM_HASHED_STR())", label, seed);
+        }
+    }
+
+    // ID stack
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    ImGui::NewFrame();
+    ImGui::Begin("Hash Test");
+    for (const LabelInfo& info : DemoLabels)
+    {
+        const char* label = info.Label;
+        const ImGuiID seed = ImGui::GetID("");
+        Check(ImGui::GetID(info.Hashed) == ImGui::GetID(label), "GetID(IM_HASHED_STR())", label, seed);
+
+        ImGui::PushID(label);
+        const ImGuiID id_in_scope = ImGui::GetID("Child");
+        ImGui::PopID();
+        ImGui::PushID(info.Hashed);
+        Check(ImGui::GetID("Child") == id_in_scope, "PushID(IM_HASHED_STR())", label, seed);
+        ImGui::PopID();
+
+        ImGui::SetNextItemHashedLabel(info.Hashed);
+        ImGui::Button(label);
+        Check(ImGui::GetItemID() == ImGui::GetID(label), "Button() with SetNextItemHashedLabel()", label, seed);
+    }
+    ImGui::PushID(IM_HASHED_STR("Scope"));
+    Check(ImGui::Checkbox(IM_HASHED_LABEL("Checkbox##1"), &io.ConfigDebugIsDebuggerPresent) || ImGui::GetItemID() == ImGui::GetID("Checkbox##1"), "Checkbox(IM_HASHED_LABEL())", "Checkbox##1", ImGui::GetID(""));
+    Check((ImGui::TreeNode(IM_HASHED_LABEL("Node###Node")), ImGui::GetItemID() == ImGui::GetID("Other###Node")), "TreeNode(IM_HASHED_LABEL())", "Node###Node", ImGui::GetID(""));
+    ImGui::PopID();
+    ImGui::End();
+    ImGui::Render();
+    ImGui::DestroyContext();
+
+    printf("%d labels, %d checks, %d errors.\n", IM_ARRAYSIZE(DemoLabels), g_ChecksCount, g_ErrorsCount);
+    return (g_ErrorsCount > 0) ? 1 : 0;
+}
@@ -0,0 +1,3 @@
+@REM Build for Visual Studio compiler. Run your copy of vcvars32.bat or vcvarsall.bat to setup command-line compiler.
+mkdir Debug
+cl /nologo /Zi /MD /utf-8 /I ..\.. /I ..\..\misc\replay %* *.cpp ..\..\*.cpp ..\..\misc\replay\*.cpp /FeDebug/example_null_replay.exe /FoDebug/ /link gdi32.lib shell32.lib imm32.lib
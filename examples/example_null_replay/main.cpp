@@ -0,0 +1,172 @@
+// dear imgui: "null" example application + input recording and replay
+// (compile and link imgui + misc/replay, create context, run headless, NO GRAPHICS OUTPUT)
+// Usage:
+//   example_null_replay                        Record a scripted session in memory, replay it in a new context and compare.
+//   example_null_replay record <file>          Record a scripted session to a file.
+//   example_null_replay replay <file>          Replay a session from a file, e.g. recorded with an older build, and compare.
+// In your own application you would record real user sessions with ImGuiInputRecorder, and replay them
+// in a headless application like this one, submitting the same UI code.
+#include "imgui.h"
+#include "imgui_replay.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// Application state: everything the UI code reads needs to start from the same values when recording and replaying.
+struct AppState
+{
+    bool    Checkbox = false;
+    int     Counter = 0;
+    float   Slider = 0.5f;
+    char    Text[64] = "";
+    int     Selected = -1;
+};
+
+static void ShowAppWindows(AppState* state)
+{
+    ImGui::SetNextWindowPos(ImVec2(20, 20), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(400, 500), ImGuiCond_FirstUseEver);
+    ImGui::Begin("Replay");
+    ImGui::Checkbox("Checkbox", &state->Checkbox);
+    if (ImGui::Button("Button"))
+        state->Counter++;
+    ImGui::SameLine();
+    ImGui::Text("Counter = %d", state->Counter);
+    ImGui::SliderFloat("Slider", &state->Slider, 0.0f, 1.0f);
+    ImGui::InputText("Text", state->Text, IM_ARRAYSIZE(state->Text));
+    if (ImGui::BeginChild("List", ImVec2(0, 0), ImGuiChildFlags_Borders))
+    {
+        for (int n = 0; n < 200; n++)
+        {
+            char label[32];
+            snprintf(label, sizeof(label), "Item %d", n);
+            if (ImGui::Selectable(label, state->Selected == n))
+                state->Selected = n;
+        }
+    }
+    ImGui::EndChild();
+    ImGui::End();
+}
+
+// Scripted inputs: deterministic pseudo-random mouse moves, clicks, wheel and typing
+static void SubmitScriptedInputs(ImGuiIO& io, int frame)
+{
+    static const char text[] = "Hello, world!";
+    const unsigned int r = (unsigned int)frame * 2654435761u;
+    if (frame % 120 < 100)
+        io.AddMousePosEvent(30.0f + (float)((r >> 8) % 380), 40.0f + (float)((r >> 16) % 480));
+    if (frame % 30 == 10)
+        io.AddMouseButtonEvent(0, true);
+    if (frame % 30 == 12)
+        io.AddMouseButtonEvent(0, false);
+    if (frame % 45 == 20)
+        io.AddMouseWheelEvent(0.0f, (frame % 90 < 45) ? -1.0f : 1.0f);
+    if (frame >= 200 && frame < 200 + (int)sizeof(text) - 1)
+        io.AddInputCharacter((unsigned int)text[frame - 200]);
+    if (frame == 230 || frame == 231)
+        io.AddKeyEvent(ImGuiKey_Backspace, frame == 230);
+}
+
+static ImGuiContext* CreateHeadlessContext()
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    unsigned char* tex_pixels = nullptr;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    return ctx;
+}
+
+static void Record(ImGuiInputRecorder* recorder, int frame_count)
+{
+    ImGuiContext* ctx = CreateHeadlessContext();
+    ImGuiIO& io = ImGui::GetIO();
+    AppState state;
+    recorder->Start(ctx);
+    for (int n = 0; n < frame_count; n++)
+    {
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+        SubmitScriptedInputs(io, n);
+        ImGui::NewFrame();
+        ShowAppWindows(&state);
+        ImGui::Render();
+    }
+    recorder->Stop();
+    ImGui::DestroyContext(ctx);
+}
+
+static int Replay(ImGuiInputReplayer* replayer)
+{
+    ImGuiContext* ctx = CreateHeadlessContext();
+    AppState state;
+    replayer->Start(ctx);
+    while (replayer->IsPlaying())
+    {
+        ImGui::NewFrame();
+        ShowAppWindows(&state);
+        ImGui::Render();
+    }
+    replayer->Stop();
+    ImGui::DestroyContext(ctx);
+
+    double recorded_total = 0.0, replayed_total = 0.0;
+    for (float t : replayer->RecordedFrameTimes)
+        recorded_total += t;
+    for (float t : replayer->ReplayedFrameTimes)
+        replayed_total += t;
+    printf("Frames: %d, ImDrawData hash mismatches: %d", replayer->FramesCount, replayer->HashMismatchCount);
+    if (replayer->HashMismatchCount > 0)
+        printf(" (first at frame %d)", replayer->FirstHashMismatchFrame);
+    printf("\n");
+    printf("Stream:   %d bytes (%.1f bytes/frame)\n", replayer->Data.Size, (double)replayer->Data.Size / replayer->FramesCount);
+    printf("Recorded: %.3f ms/frame\n", recorded_total / replayer->FramesCount);
+    printf("Replayed: %.3f ms/frame\n", replayed_total / replayer->FramesCount);
+    return replayer->HashMismatchCount == 0 ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    const int frame_count = 600;
+
+    if (argc == 3 && strcmp(argv[1], "record") == 0)
+    {
+        ImGuiInputRecorder recorder;
+        Record(&recorder, frame_count);
+        if (!recorder.SaveToFile(argv[2]))
+        {
+            fprintf(stderr, "Failed to write '%s'\n", argv[2]);
+            return 1;
+        }
+        printf("Recorded %d frames to '%s' (%d bytes)\n", recorder.FramesCount, argv[2], recorder.Data.Size);
+        return 0;
+    }
+
+    ImGuiInputReplayer replayer;
+    if (argc == 3 && strcmp(argv[1], "replay") == 0)
+    {
+        if (!replayer.LoadFromFile(argv[2]))
+        {
+            fprintf(stderr, "Failed to load '%s'\n", argv[2]);
+            return 1;
+        }
+    }
+    else if (argc == 1)
+    {
+        ImGuiInputRecorder recorder;
+        Record(&recorder, frame_count);
+        if (!replayer.LoadFromMemory(recorder.Data.Data, (size_t)recorder.Data.Size))
+        {
+            fprintf(stderr, "Failed to load recorded session\n");
+            return 1;
+        }
+    }
+    else
+    {
+        fprintf(stderr, "Usage: %s [record <file> | replay <file>]\n", argv[0]);
+        return 1;
+    }
+    return Replay(&replayer);
+}
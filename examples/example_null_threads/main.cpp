@@ -0,0 +1,221 @@
+// dear imgui: "null" example application + multi-threaded contexts stress test
+// (compile and link imgui with IMGUI_THREAD_LOCAL_CONTEXT, run headless, NO GRAPHICS OUTPUT)
+// - A reference context runs a scripted UI for a number of frames on the main thread, recording a hash of each frame's ImDrawData.
+// - Then several contexts run the same script concurrently, each on its own thread, sharing a font atlas locked with SetLockedShared().
+//   Every frame they render must be identical to the reference frame.
+// - Each thread also creates and destroys private font atlases loading the same font files, which exercises the shared font data registry.
+// Returns non-zero on any mismatch.
+// Usage:
+//   example_null_threads [threads_count] [fonts_dir]      (default: 8 threads, fonts loaded from "../../misc/fonts")
+#include "imgui.h"
+#include "imgui_internal.h" // ImHashData
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#ifndef IMGUI_THREAD_LOCAL_CONTEXT
+#error "This example requires IMGUI_THREAD_LOCAL_CONTEXT to be defined."
+#endif
+
+static const int FRAMES_COUNT = 120;
+
+// UI state is stored per context: functions with static variables (e.g. ShowDemoWindow()) can't run on multiple threads.
+struct AppState
+{
+    bool    Checkbox = true;
+    int     Counter = 0;
+    float   Slider = 0.5f;
+    int     Radio = 0;
+    char    Text[64] = "Hello, world!";
+    float   Color[3] = { 1.0f, 0.5f, 0.25f };
+};
+
+// Deterministic input: mouse moves, clicks and wheel, keyboard text.
+static void FeedInputs(ImGuiIO& io, int frame)
+{
+    const float t = (float)frame / FRAMES_COUNT;
+    io.AddMousePosEvent(40.0f + 500.0f * t, 60.0f + 300.0f * ((frame % 40) / 40.0f));
+    io.AddMouseButtonEvent(0, (frame % 10) >= 5);
+    if ((frame % 17) == 0)
+        io.AddMouseWheelEvent(0.0f, -1.0f);
+    if ((frame % 13) == 0)
+        io.AddInputCharacter((unsigned int)('a' + (frame % 26)));
+}
+
+static void ShowTestUI(AppState& state, int frame)
+{
+    ImGui::SetNextWindowPos(ImVec2(20, 20), ImGuiCond_Once);
+    ImGui::SetNextWindowSize(ImVec2(400, 500), ImGuiCond_Once);
+    ImGui::Begin("Widgets");
+    ImGui::Text("Frame %d, counter %d", frame, state.Counter);
+    if (ImGui::Button("Increment"))
+        state.Counter++;
+    ImGui::SameLine();
+    ImGui::Checkbox("Checkbox", &state.Checkbox);
+    ImGui::SliderFloat("Slider", &state.Slider, 0.0f, 1.0f, "%.3f");
+    ImGui::RadioButton("A", &state.Radio, 0); ImGui::SameLine();
+    ImGui::RadioButton("B", &state.Radio, 1); ImGui::SameLine();
+    ImGui::RadioButton("C", &state.Radio, 2);
+    ImGui::InputText("Input", state.Text, IM_ARRAYSIZE(state.Text));
+    ImGui::ColorEdit3("Color", state.Color);
+    ImGui::ProgressBar(state.Slider);
+    if (ImGui::TreeNodeEx("Tree", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        for (int n = 0; n < 5; n++)
+            ImGui::BulletText("Item %d: %.2f", n, n * state.Slider);
+        ImGui::TreePop();
+    }
+    if (ImGui::BeginTable("Table", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable))
+    {
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Hex");
+        ImGui::TableHeadersRow();
+        for (int row = 0; row < 20; row++)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("Row %d", row);
+            ImGui::TableNextColumn(); ImGui::Text("%d", row * state.Counter);
+            ImGui::TableNextColumn(); ImGui::Text("0x%04X", row * 0x111);
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+
+    ImGui::SetNextWindowPos(ImVec2(440, 20), ImGuiCond_Once);
+    ImGui::SetNextWindowSize(ImVec2(300, 200), ImGuiCond_Once);
+    ImGui::Begin("Plots");
+    float values[32];
+    for (int n = 0; n < IM_ARRAYSIZE(values); n++)
+        values[n] = (float)((n * 7 + frame) % 16) / 16.0f;
+    ImGui::PlotLines("Lines", values, IM_ARRAYSIZE(values));
+    ImGui::PlotHistogram("Histogram", values, IM_ARRAYSIZE(values));
+    ImGui::End();
+}
+
+static ImU32 HashDrawData(const ImDrawData* draw_data)
+{
+    ImU32 hash = ImHashData(&draw_data->TotalVtxCount, sizeof(int), 0);
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+        hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            hash = ImHashData(&cmd.ClipRect, sizeof(cmd.ClipRect), hash);
+            hash = ImHashData(&cmd.TextureId, sizeof(cmd.TextureId), hash);
+            hash = ImHashData(&cmd.VtxOffset, sizeof(cmd.VtxOffset), hash);
+            hash = ImHashData(&cmd.IdxOffset, sizeof(cmd.IdxOffset), hash);
+            hash = ImHashData(&cmd.ElemCount, sizeof(cmd.ElemCount), hash);
+        }
+    }
+    return hash;
+}
+
+// Run the scripted UI in a new context using the shared atlas, storing the hash of each frame.
+static void RunContext(ImFontAtlas* shared_atlas, ImU32* out_hashes)
+{
+    ImGui::CreateContext(shared_atlas);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+
+    AppState state;
+    for (int frame = 0; frame < FRAMES_COUNT; frame++)
+    {
+        FeedInputs(io, frame);
+        ImGui::NewFrame();
+        ShowTestUI(state, frame);
+        ImGui::Render();
+        out_hashes[frame] = HashDrawData(ImGui::GetDrawData());
+    }
+    ImGui::DestroyContext();
+}
+
+// Create and destroy private atlases loading font files: font data is shared between atlases through a process-wide registry.
+static int LoadPrivateFonts(const char* fonts_dir)
+{
+    static const char* font_files[] = { "Roboto-Medium.ttf", "Cousine-Regular.ttf", "DroidSans.ttf", "ProggyTiny.ttf" };
+    int fonts_count = 0;
+    for (int n = 0; n < 4; n++)
+    {
+        ImFontAtlas atlas;
+        atlas.AddFontDefault();
+        for (const char* font_file : font_files)
+        {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/%s", fonts_dir, font_file);
+            if (atlas.AddFontFromFileTTF(path, 13.0f + n) != NULL)
+                fonts_count++;
+        }
+        unsigned char* pixels;
+        int width, height;
+        atlas.GetTexDataAsAlpha8(&pixels, &width, &height);
+    }
+    return fonts_count;
+}
+
+struct ThreadData
+{
+    std::thread         Thread;
+    std::vector<ImU32>  Hashes;
+    int                 FontsCount = 0;
+};
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    const int threads_count = (argc >= 2) ? atoi(argv[1]) : 8;
+    const char* fonts_dir = (argc >= 3) ? argv[2] : "../../misc/fonts";
+
+    // Build the shared atlas, then lock it so it can be used by contexts running concurrently.
+    ImFontAtlas shared_atlas;
+    shared_atlas.AddFontDefault();
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    shared_atlas.GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    shared_atlas.SetLockedShared(true);
+
+    // Reference run, on the main thread
+    std::vector<ImU32> ref_hashes(FRAMES_COUNT);
+    RunContext(&shared_atlas, ref_hashes.data());
+    const int ref_fonts_count = LoadPrivateFonts(fonts_dir);
+
+    // Concurrent runs
+    std::vector<ThreadData> threads(threads_count);
+    for (ThreadData& thread : threads)
+    {
+        thread.Hashes.resize(FRAMES_COUNT);
+        ThreadData* thread_data = &thread;
+        thread.Thread = std::thread([&shared_atlas, fonts_dir, thread_data]()
+        {
+            RunContext(&shared_atlas, thread_data->Hashes.data());
+            thread_data->FontsCount = LoadPrivateFonts(fonts_dir);
+        });
+    }
+
+    int errors = 0;
+    for (int thread_n = 0; thread_n < threads_count; thread_n++)
+    {
+        ThreadData& thread = threads[thread_n];
+        thread.Thread.join();
+        for (int frame = 0; frame < FRAMES_COUNT; frame++)
+            if (thread.Hashes[frame] != ref_hashes[frame])
+            {
+                fprintf(stderr, "Thread %d: frame %d differs from reference (hash %08X, expected %08X)\n", thread_n, frame, thread.Hashes[frame], ref_hashes[frame]);
+                errors++;
+            }
+        if (thread.FontsCount != ref_fonts_count)
+        {
+            fprintf(stderr, "Thread %d: loaded %d fonts, expected %d\n", thread_n, thread.FontsCount, ref_fonts_count);
+            errors++;
+        }
+    }
+    shared_atlas.SetLockedShared(false);
+
+    printf("%d threads, %d frames, %d fonts loaded per thread, %d errors.\n", threads_count, FRAMES_COUNT, ref_fonts_count, errors);
+    return (errors > 0) ? 1 : 0;
+}
@@ -47,10 +47,20 @@
 //#define IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS              // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 so you can implement them yourself.
 //#define IMGUI_DISABLE_FILE_FUNCTIONS                      // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle at all (replace them with dummies)
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
+//#define IMGUI_DISABLE_FILE_MAPPING                        // Don't memory-map font files in AddFontFromFileTTF() (Win32: MapViewOfFile(), Mac/Linux: mmap()), always load them into a heap copy with ImFileLoadToMemory(). Implied by IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_DEFAULT_FONT                        // Disable default embedded font (ProggyClean.ttf), remove ~9.5 KB from output binary. AddFontDefault() will assert.
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
 
+//---- Use thread-local storage for the current context pointer (GImGui) and for the allocator functions set with SetAllocatorFunctions().
+// This allows N threads to each run their own context concurrently, e.g. one UI per remote session on a server. Requires C++11 'thread_local'.
+// A built font atlas may be shared by those contexts: call ImFontAtlas::SetLockedShared(true) before starting the threads.
+//#define IMGUI_THREAD_LOCAL_CONTEXT
+
+//---- Enable lock-free queue for input events posted from other threads (e.g. high-rate pen/mouse input thread). See CreateInputEventThreadQueue() in imgui_internal.h.
+// Requires C++11 <atomic>, which is otherwise not included.
+//#define IMGUI_ENABLE_INPUT_THREAD_QUEUE
+
 //---- Enable Test Engine / Automation features.
 //#define IMGUI_ENABLE_TEST_ENGINE                          // Enable imgui_test_engine hooks. Generally set automatically by include "imgui_te_config.h", see Test Engine for details.
 
@@ -133,6 +143,15 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Record call-site (file/line) of every IM_ALLOC() and aggregate them in 'Metrics->Memory allocations->Call sites'.
+// Adds overhead to every allocation. Must be defined identically for all compilation units including imgui.h.
+//#define IMGUI_DEBUG_ALLOC_CALLSITES
+
+//---- Debug Tools: Record timing of internal scopes (NewFrame, Begin/End, tables layout, Render...) over the last frames.
+// See 'Metrics->Profiler' for a per-window/per-table breakdown and Chrome trace export (chrome://tracing, ui.perfetto.dev).
+// Scopes are compiled out when not defined.
+//#define IMGUI_ENABLE_PROFILER
+
 //---- Tip: You can add extra functions within the ImGui:: namespace from anywhere (e.g. your own sources/header files)
 /*
 namespace ImGui
@@ -71,7 +71,8 @@ CODE
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImGuiTextRingBuffer
+// [SECTION] ImFrameArena
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -1073,6 +1074,15 @@ CODE
 // System includes
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #include <stdint.h>     // intptr_t
+#if !defined(IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS) && !defined(IMGUI_USE_STB_SPRINTF)
+#include <locale.h>     // localeconv, for ImFormatStringFastV
+#endif
+#ifdef IMGUI_ENABLE_INPUT_THREAD_QUEUE
+#include <atomic>       // std::atomic, for ImGuiInputEventThreadQueue
+#endif
+#ifdef IMGUI_ENABLE_PROFILER
+#include <chrono>       // std::chrono::steady_clock
+#endif
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -1100,6 +1110,22 @@ CODE
 #define IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS
 #define IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS
 #define IMGUI_DISABLE_DEFAULT_SHELL_FUNCTIONS
+#define IMGUI_DISABLE_FILE_MAPPING
+#endif
+#endif
+
+// File mapping (for ImFileMapToMemory)
+#if defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) || (defined(_WIN32) && defined(IMGUI_DISABLE_WIN32_FUNCTIONS))
+#define IMGUI_DISABLE_FILE_MAPPING
+#endif
+#if !defined(IMGUI_DISABLE_FILE_MAPPING) && !defined(_WIN32)
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // mmap, munmap
+#include <sys/stat.h>   // fstat
+#include <unistd.h>     // close
+#else
+#define IMGUI_DISABLE_FILE_MAPPING
 #endif
 #endif
 
@@ -1241,6 +1267,7 @@ static void             UpdateKeyRoutingTable(ImGuiKeyRoutingTable* rt);
 
 // Misc
 static void             UpdateSettings();
+static void             UpdateNextRefreshDelay();
 static int              UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_hovered, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, bool handle_borders_and_resize_grips, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1271,7 +1298,10 @@ static void             UpdateViewportsNewFrame();
 //   Change to a different context by calling ImGui::SetCurrentContext().
 // - Important: Dear ImGui functions are not thread-safe because of this pointer.
 //   If you want thread-safety to allow N threads to access N different contexts:
-//   - Change this variable to use thread local storage so each thread can refer to a different context, in your imconfig.h:
+//   - '#define IMGUI_THREAD_LOCAL_CONTEXT' in your imconfig.h. This variable and the allocator functions below become thread-local,
+//     so each thread refers to its own context and uses its own allocator functions (call SetAllocatorFunctions() from each thread if needed).
+//     Create, use and destroy each context from the same thread. A built ImFontAtlas may be shared by all contexts after calling SetLockedShared(true).
+//   - Or change this variable to use your own thread local storage, in your imconfig.h:
 //         struct ImGuiContext;
 //         extern thread_local ImGuiContext* MyImGuiTLS;
 //         #define GImGui MyImGuiTLS
@@ -1280,11 +1310,16 @@ static void             UpdateViewportsNewFrame();
 //   - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from a different namespace.
 // - DLL users: read comments above.
 #ifndef GImGui
+#ifdef IMGUI_THREAD_LOCAL_CONTEXT
+thread_local ImGuiContext* GImGui = NULL;
+#else
 ImGuiContext*   GImGui = NULL;
 #endif
+#endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
 // - You probably don't want to modify that mid-program, and if you use global/static e.g. ImVector<> instances you may need to keep them accessible during program destruction.
+// - With IMGUI_THREAD_LOCAL_CONTEXT they are per thread, each thread starting with the default ones. Memory must be freed from the thread which allocated it.
 // - DLL users: read comments above.
 #ifndef IMGUI_DISABLE_DEFAULT_ALLOCATORS
 static void*   MallocWrapper(size_t size, void* user_data)    { IM_UNUSED(user_data); return malloc(size); }
@@ -1293,9 +1328,15 @@ static void    FreeWrapper(void* ptr, void* user_data)        { IM_UNUSED(user_d
 static void*   MallocWrapper(size_t size, void* user_data)    { IM_UNUSED(user_data); IM_UNUSED(size); IM_ASSERT(0); return NULL; }
 static void    FreeWrapper(void* ptr, void* user_data)        { IM_UNUSED(user_data); IM_UNUSED(ptr); IM_ASSERT(0); }
 #endif
+#ifdef IMGUI_THREAD_LOCAL_CONTEXT
+static thread_local ImGuiMemAllocFunc   GImAllocatorAllocFunc = MallocWrapper;
+static thread_local ImGuiMemFreeFunc    GImAllocatorFreeFunc = FreeWrapper;
+static thread_local void*               GImAllocatorUserData = NULL;
+#else
 static ImGuiMemAllocFunc    GImAllocatorAllocFunc = MallocWrapper;
 static ImGuiMemFreeFunc     GImAllocatorFreeFunc = FreeWrapper;
 static void*                GImAllocatorUserData = NULL;
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO, ImGuiPlatformIO)
@@ -2008,11 +2049,52 @@ const char* ImStrbol(const char* buf_mid_line, const char* buf_begin) // find be
     return buf_mid_line;
 }
 
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_STRISTR_SSE2
+// Upper-case 16 ASCII characters at once (same as ImToUpper(): bytes >= 0x80 are negative as signed and left untouched)
+static inline __m128i ImToUpper16(__m128i v)
+{
+    const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+    return _mm_sub_epi8(v, _mm_and_si128(is_lower, _mm_set1_epi8(0x20)));
+}
+#endif
+
 const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
 {
     if (!needle_end)
         needle_end = needle + strlen(needle);
 
+#ifdef IMGUI_ENABLE_STRISTR_SSE2
+    // Fast path: test 16 candidate positions at once by comparing both first and last characters of needle,
+    // then only verify the remaining characters for positions where both matched.
+    const int needle_len = (int)(needle_end - needle);
+    if (needle_len > 0)
+    {
+        if (!haystack_end)
+            haystack_end = haystack + strlen(haystack);
+        const __m128i first = _mm_set1_epi8(ImToUpper(needle[0]));
+        const __m128i last = _mm_set1_epi8(ImToUpper(needle_end[-1]));
+        for (; haystack_end - haystack >= needle_len - 1 + 16; haystack += 16)
+        {
+            const __m128i block_first = ImToUpper16(_mm_loadu_si128((const __m128i*)(const void*)haystack));
+            const __m128i block_last = ImToUpper16(_mm_loadu_si128((const __m128i*)(const void*)(haystack + needle_len - 1)));
+            unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+            for (int bit_n = 0; mask != 0; bit_n++, mask >>= 1)
+            {
+                if ((mask & 1) == 0)
+                    continue;
+                const char* a = haystack + bit_n + 1;
+                const char* b = needle + 1;
+                for (; b < needle_end - 1; a++, b++)
+                    if (ImToUpper(*a) != ImToUpper(*b))
+                        break;
+                if (b >= needle_end - 1)
+                    return haystack + bit_n;
+            }
+        }
+    }
+#endif
+
     const char un0 = (char)ImToUpper(*needle);
     while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
     {
@@ -2060,8 +2142,7 @@ const char* ImStrSkipBlank(const char* str)
 
 // We support stb_sprintf which is much faster (see: https://github.com/nothings/stb/blob/master/stb_sprintf.h)
 // You may set IMGUI_USE_STB_SPRINTF to use our default wrapper, or set IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
-// and setup the wrapper yourself. (FIXME-OPT: Some of our high-level operations such as ImGuiTextBuffer::appendfv() are
-// designed using two-passes worst case, which probably could be improved using the stbsp_vsprintfcb() function.)
+// and setup the wrapper yourself. Without stb_sprintf, the most common formats are handled by ImFormatStringFastV() below.
 #ifdef IMGUI_USE_STB_SPRINTF
 #ifndef IMGUI_DISABLE_STB_SPRINTF_IMPLEMENTATION
 #define STB_SPRINTF_IMPLEMENTATION
@@ -2077,6 +2158,302 @@ const char* ImStrSkipBlank(const char* str)
 #define vsnprintf _vsnprintf
 #endif
 
+#ifndef IMGUI_USE_STB_SPRINTF
+// Fast path for the formats we use the most (e.g. "%d", "%.3f", "0x%08X", "%s: %d"), bypassing vsnprintf().
+// - Supports conversions d i u x X c s f with flags - 0 + space, width, precision (0..9 for f, any or '*' for s), length l ll.
+// - %f is formatted exactly like libc (correctly rounded, ties-to-even on the exact binary value), as long as value*10^precision
+//   fits in 64 bits. Anything else (%g, %e, %p, '*' width...) returns -1 without reading any argument, and we fall back to vsnprintf().
+// - %f is only handled when the C locale decimal point is '.', otherwise it goes to vsnprintf() so output matches libc in all locales.
+//   This is checked on every call formatting a float, so changing LC_NUMERIC at any time is supported.
+// - Parsing is a single pass over a few characters, which is cheaper than any lookup in a cache of parsed formats would be.
+struct ImFormatSpec
+{
+    char    Conv;           // 'd', 'u', 'x', 'X', 'c', 's', 'f'
+    char    Length;         // 0, 'l' or 'L' (for "ll")
+    bool    LeftAlign, ZeroPad, PlusSign, SpaceSign;
+    int     Width;
+    int     Precision;      // -1: none, -2: '*'
+};
+
+struct ImFormatWriter
+{
+    char*   Buf;
+    int     BufSize;
+    int     Len;            // Total length, may exceed BufSize
+    void    Put(char c)                     { if (Len < BufSize - 1) Buf[Len] = c; Len++; }
+    void    Put(const char* s, int s_len)   { int n = ImMin(s_len, BufSize - 1 - Len); if (n > 0) memcpy(Buf + Len, s, (size_t)n); Len += s_len; }
+    void    Pad(char c, int count)          { for (int n = 0; n < count; n++) Put(c); }
+};
+
+// Parse a conversion specification after '%'. Return pointer past it, or NULL if not supported by our fast path.
+static const char* ImFormatParseSpec(const char* p, ImFormatSpec* spec)
+{
+    spec->LeftAlign = spec->ZeroPad = spec->PlusSign = spec->SpaceSign = false;
+    for (;; p++)
+    {
+        if (*p == '-')      spec->LeftAlign = true;
+        else if (*p == '0') spec->ZeroPad = true;
+        else if (*p == '+') spec->PlusSign = true;
+        else if (*p == ' ') spec->SpaceSign = true;
+        else break;
+    }
+    spec->Width = 0;
+    for (; *p >= '0' && *p <= '9'; p++)
+        if ((spec->Width = spec->Width * 10 + (*p - '0')) > 256)
+            return NULL;
+    spec->Precision = -1;
+    if (*p == '.')
+    {
+        p++;
+        if (*p == '*')
+        {
+            spec->Precision = -2;
+            p++;
+        }
+        else
+        {
+            spec->Precision = 0;
+            for (; *p >= '0' && *p <= '9'; p++)
+                if ((spec->Precision = spec->Precision * 10 + (*p - '0')) > 256)
+                    return NULL;
+        }
+    }
+    spec->Length = 0;
+    if (p[0] == 'l' && p[1] == 'l') { spec->Length = 'L'; p += 2; }
+    else if (p[0] == 'l')           { spec->Length = 'l'; p += 1; }
+
+    const char c = *p;
+    if (c == 'd' || c == 'i')                       spec->Conv = 'd';
+    else if (c == 'u' || c == 'x' || c == 'X')      spec->Conv = c;
+    else if (c == 'f')                              spec->Conv = 'f';
+    else if (c == 'c' || c == 's')                  spec->Conv = c;
+    else
+        return NULL;
+    if (spec->Conv == 'f' && (spec->Precision < -1 || spec->Precision > 9 || spec->Length == 'L'))
+        return NULL;
+    if ((spec->Conv == 'c' || spec->Conv == 's') && (spec->Length != 0 || spec->ZeroPad || spec->PlusSign || spec->SpaceSign))
+        return NULL;
+    if ((spec->Conv == 'd' || spec->Conv == 'u' || spec->Conv == 'x' || spec->Conv == 'X' || spec->Conv == 'c') && spec->Precision != -1)
+        return NULL;
+    return p + 1;
+}
+
+// Calculate round(v * 10^precision) exactly, using ties-to-even on the exact binary value (like libc). Return false on overflow/nan/inf.
+static bool ImFormatFloatToScaledInteger(double v, int precision, ImU64* out)
+{
+    ImU64 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    const int biased_exp = (int)((bits >> 52) & 0x7FF);
+    if (biased_exp == 0x7FF)
+        return false;
+    const ImU64 mantissa = (bits & (((ImU64)1 << 52) - 1)) | (biased_exp != 0 ? ((ImU64)1 << 52) : 0);
+    const int exp2 = (biased_exp != 0 ? biased_exp : 1) - 1075; // v = mantissa * 2^exp2
+
+    // 'prod = mantissa * 10^precision' fits in 53+30 bits, stored as hi:lo
+    ImU64 pow10 = 1;
+    for (int n = 0; n < precision; n++)
+        pow10 *= 10;
+    const ImU64 prod_mid = (mantissa >> 32) * pow10;
+    const ImU64 prod_low = (mantissa & 0xFFFFFFFF) * pow10;
+    ImU64 lo = prod_low + (prod_mid << 32);
+    ImU64 hi = (prod_mid >> 32) + (lo < prod_low ? 1 : 0);
+
+    if (exp2 >= 0)
+    {
+        if (hi != 0 || exp2 >= 64 || (exp2 > 0 && (lo >> (64 - exp2)) != 0))
+            return false;
+        *out = lo << exp2;
+        return true;
+    }
+
+    // Shift right by 's' and round to nearest, ties to even
+    const int s = -exp2;
+    ImU64 q;
+    int rem_vs_half; // <0, 0, >0
+    if (s < 64)
+    {
+        if ((hi >> s) != 0)
+            return false;
+        q = (lo >> s) | (hi << (64 - s));
+        const ImU64 rem = lo & (((ImU64)1 << s) - 1), half = (ImU64)1 << (s - 1);
+        rem_vs_half = (rem < half) ? -1 : (rem > half) ? +1 : 0;
+    }
+    else if (s == 64)
+    {
+        q = hi;
+        rem_vs_half = (lo < ((ImU64)1 << 63)) ? -1 : (lo > ((ImU64)1 << 63)) ? +1 : 0;
+    }
+    else if (s < 128)
+    {
+        q = hi >> (s - 64);
+        const ImU64 rem_hi = hi & (((ImU64)1 << (s - 64)) - 1), half_hi = (ImU64)1 << (s - 65);
+        rem_vs_half = (rem_hi < half_hi) ? -1 : (rem_hi > half_hi || lo != 0) ? +1 : 0;
+    }
+    else
+    {
+        q = 0;
+        rem_vs_half = -1; // prod < 2^83 <= 2^(s-1)
+    }
+    if (rem_vs_half > 0 || (rem_vs_half == 0 && (q & 1)))
+        if (++q == 0)
+            return false;
+    *out = q;
+    return true;
+}
+
+// Write digits or string with sign and padding
+static void ImFormatWritePadded(ImFormatWriter* w, const ImFormatSpec& spec, const char* digits, int digits_len, char sign)
+{
+    const int pad = ImMax(spec.Width - digits_len - (sign ? 1 : 0), 0);
+    if (!spec.LeftAlign && !spec.ZeroPad)
+        w->Pad(' ', pad);
+    if (sign)
+        w->Put(sign);
+    if (!spec.LeftAlign && spec.ZeroPad)
+        w->Pad('0', pad);
+    w->Put(digits, digits_len);
+    if (spec.LeftAlign)
+        w->Pad(' ', pad);
+}
+
+static void ImFormatWriteInteger(ImFormatWriter* w, const ImFormatSpec& spec, ImU64 value, bool negative)
+{
+    char digits[24];
+    char* p = digits + IM_ARRAYSIZE(digits);
+    if (spec.Conv == 'x' || spec.Conv == 'X')
+    {
+        const char* hex = (spec.Conv == 'x') ? "0123456789abcdef" : "0123456789ABCDEF";
+        do { *--p = hex[value & 15]; value >>= 4; } while (value != 0);
+    }
+    else
+    {
+        do { *--p = (char)('0' + (value % 10)); value /= 10; } while (value != 0);
+    }
+    const char sign = negative ? '-' : (spec.Conv != 'd') ? 0 : spec.PlusSign ? '+' : spec.SpaceSign ? ' ' : 0;
+    ImFormatWritePadded(w, spec, p, (int)(digits + IM_ARRAYSIZE(digits) - p), sign);
+}
+
+static void ImFormatWriteFloat(ImFormatWriter* w, const ImFormatSpec& spec, double v)
+{
+    const int precision = (spec.Precision < 0) ? 6 : spec.Precision;
+    ImU64 scaled;
+    if (!ImFormatFloatToScaledInteger(v, precision, &scaled))
+    {
+        // Large values, nan, inf: let libc format this single value
+        // (width <= 256 and 'double' has at most 309 integer digits, so this fits)
+        char spec_fmt[24], tmp[512];
+        sprintf(spec_fmt, "%%%s%s%s%s%d.%df", spec.LeftAlign ? "-" : "", spec.ZeroPad ? "0" : "", spec.PlusSign ? "+" : "", spec.SpaceSign ? " " : "", spec.Width, precision);
+        w->Put(tmp, sprintf(tmp, spec_fmt, v));
+        return;
+    }
+    char digits[32];
+    char* p = digits + IM_ARRAYSIZE(digits);
+    for (int n = 1; scaled != 0 || n <= precision + 1; n++)
+    {
+        *--p = (char)('0' + (scaled % 10));
+        scaled /= 10;
+        if (n == precision)
+            *--p = '.';
+    }
+    const char sign = (v < 0.0 || (v == 0.0 && 1.0 / v < 0.0)) ? '-' : spec.PlusSign ? '+' : spec.SpaceSign ? ' ' : 0;
+    ImFormatWritePadded(w, spec, p, (int)(digits + IM_ARRAYSIZE(digits) - p), sign);
+}
+
+static void ImFormatWriteString(ImFormatWriter* w, const ImFormatSpec& spec, const char* s, int precision)
+{
+    if (s == NULL)
+        s = "(null)";
+    int s_len = 0;
+    if (precision >= 0)
+        while (s_len < precision && s[s_len] != 0)
+            s_len++;
+    else
+        s_len = (int)strlen(s);
+    ImFormatWritePadded(w, spec, s, s_len, 0);
+}
+
+// Return true if the current C locale uses '.' as decimal point.
+// Not cached: the locale may be changed at any time (possibly per thread with uselocale()), and localeconv() is cheap next to formatting a float.
+static bool ImFormatIsDecimalPointDot()
+{
+    const char* decimal_point = localeconv()->decimal_point;
+    return decimal_point != NULL && decimal_point[0] == '.' && decimal_point[1] == 0;
+}
+
+// Return total length (like vsnprintf) or -1 if 'fmt' is not supported by our fast path, in which case no argument has been read.
+static int ImFormatStringFastV(char* buf, size_t buf_size, const char* fmt, va_list args)
+{
+    if (buf_size == 0 && buf != NULL)
+        return -1;
+
+    // Validate whole format first, so we can fall back without having consumed any argument.
+    ImFormatSpec spec;
+    bool has_float = false;
+    for (const char* p = fmt; (p = strchr(p, '%')) != NULL; )
+        if (p[1] == '%')
+            p += 2;
+        else if ((p = ImFormatParseSpec(p + 1, &spec)) == NULL)
+            return -1;
+        else
+            has_float |= (spec.Conv == 'f');
+    if (has_float && !ImFormatIsDecimalPointDot())
+        return -1;
+
+    ImFormatWriter w;
+    w.Buf = buf;
+    w.BufSize = buf ? (int)ImMin(buf_size, (size_t)INT_MAX) : 0;
+    w.Len = 0;
+    for (const char* p = fmt; *p != 0; )
+    {
+        const char* p_next = strchr(p, '%');
+        if (p_next == NULL)
+        {
+            w.Put(p, (int)strlen(p));
+            break;
+        }
+        w.Put(p, (int)(p_next - p));
+        if (p_next[1] == '%')
+        {
+            w.Put('%');
+            p = p_next + 2;
+            continue;
+        }
+        p = ImFormatParseSpec(p_next + 1, &spec);
+        switch (spec.Conv)
+        {
+        case 'd':
+        {
+            const ImS64 v = (spec.Length == 'L') ? (ImS64)va_arg(args, long long) : (spec.Length == 'l') ? (ImS64)va_arg(args, long) : (ImS64)va_arg(args, int);
+            ImFormatWriteInteger(&w, spec, (v < 0) ? (ImU64)0 - (ImU64)v : (ImU64)v, v < 0);
+            break;
+        }
+        case 'u': case 'x': case 'X':
+        {
+            const ImU64 v = (spec.Length == 'L') ? (ImU64)va_arg(args, unsigned long long) : (spec.Length == 'l') ? (ImU64)va_arg(args, unsigned long) : (ImU64)va_arg(args, unsigned int);
+            ImFormatWriteInteger(&w, spec, v, false);
+            break;
+        }
+        case 'f':
+            ImFormatWriteFloat(&w, spec, va_arg(args, double));
+            break;
+        case 'c':
+        {
+            const char c = (char)va_arg(args, int);
+            ImFormatWritePadded(&w, spec, &c, 1, 0);
+            break;
+        }
+        case 's':
+        {
+            const int precision = (spec.Precision == -2) ? va_arg(args, int) : spec.Precision;
+            ImFormatWriteString(&w, spec, va_arg(args, const char*), precision);
+            break;
+        }
+        }
+    }
+    return w.Len;
+}
+#endif // #ifndef IMGUI_USE_STB_SPRINTF
+
 int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
 {
     va_list args;
@@ -2084,7 +2461,9 @@ int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
 #ifdef IMGUI_USE_STB_SPRINTF
     int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
 #else
-    int w = vsnprintf(buf, buf_size, fmt, args);
+    int w = ImFormatStringFastV(buf, buf_size, fmt, args);
+    if (w < 0)
+        w = vsnprintf(buf, buf_size, fmt, args);
 #endif
     va_end(args);
     if (buf == NULL)
@@ -2100,7 +2479,9 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 #ifdef IMGUI_USE_STB_SPRINTF
     int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
 #else
-    int w = vsnprintf(buf, buf_size, fmt, args);
+    int w = ImFormatStringFastV(buf, buf_size, fmt, args);
+    if (w < 0)
+        w = vsnprintf(buf, buf_size, fmt, args);
 #endif
     if (buf == NULL)
         return w;
@@ -2269,6 +2650,33 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     return ~crc;
 }
 
+// Hash of a string literal pre-hashed at compile time with IM_HASHED_STR(), for a given seed.
+// CRC32 is linear: crc(seed, str) == crc(seed, zeros) ^ crc(0, str), so we only need to advance the seed over str.Len zero bytes.
+ImGuiID ImHashStr(const ImGuiHashedStr& str, ImGuiID seed)
+{
+    ImU32 crc = ~seed;
+    size_t data_size = str.Len;
+#ifndef IMGUI_ENABLE_SSE4_2_CRC
+    const ImU32* crc32_lut = GCrc32LookupTable;
+    while (data_size-- != 0)
+        crc = (crc >> 8) ^ crc32_lut[crc & 0xFF];
+#else
+#if defined(__x86_64__) || defined(_M_X64)
+    ImU64 crc64 = crc;
+    for (; data_size >= 8; data_size -= 8)
+        crc64 = _mm_crc32_u64(crc64, 0);
+    crc = (ImU32)crc64;
+#endif
+    for (; data_size >= 4; data_size -= 4)
+        crc = _mm_crc32_u32(crc, 0);
+    if (data_size >= 2)
+        crc = _mm_crc32_u16(crc, 0);
+    if (data_size & 1)
+        crc = _mm_crc32_u8(crc, 0);
+#endif
+    return ~(crc ^ str.Crc);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -2349,6 +2757,79 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+// Map a whole file into memory, read-only. Pages are loaded on demand and shared with other processes mapping the same file.
+// Falls back to ImFileLoadToMemory() when mapping is disabled (see IMGUI_DISABLE_FILE_MAPPING) or fails, in which case *out_is_mapped is set to false.
+// The file must not be modified while mapped.
+void*   ImFileMapToMemory(const char* filename, size_t* out_file_size, bool* out_is_mapped)
+{
+    IM_ASSERT(filename && out_file_size && out_is_mapped);
+    *out_file_size = 0;
+    *out_is_mapped = false;
+
+#if !defined(IMGUI_DISABLE_FILE_MAPPING) && defined(_WIN32)
+    const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
+    ImVector<wchar_t> filename_wbuf;
+    filename_wbuf.resize(filename_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, filename_wbuf.Data, filename_wsize);
+    HANDLE file = ::CreateFileW(filename_wbuf.Data, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        void* file_data = NULL;
+        LARGE_INTEGER file_size;
+        if (::GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 && (ImU64)file_size.QuadPart <= (ImU64)(size_t)-1)
+            if (HANDLE mapping = ::CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL))
+            {
+                file_data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                ::CloseHandle(mapping); // The view keeps the mapping alive
+            }
+        ::CloseHandle(file);
+        if (file_data != NULL)
+        {
+            *out_file_size = (size_t)file_size.QuadPart;
+            *out_is_mapped = true;
+            return file_data;
+        }
+    }
+#elif !defined(IMGUI_DISABLE_FILE_MAPPING)
+    int fd = ::open(filename, O_RDONLY);
+    if (fd >= 0)
+    {
+        void* file_data = MAP_FAILED;
+        struct stat file_stat;
+        if (::fstat(fd, &file_stat) == 0 && file_stat.st_size > 0)
+            file_data = ::mmap(NULL, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // The mapping stays valid after closing the descriptor
+        if (file_data != MAP_FAILED)
+        {
+            *out_file_size = (size_t)file_stat.st_size;
+            *out_is_mapped = true;
+            return file_data;
+        }
+    }
+#endif
+    return ImFileLoadToMemory(filename, "rb", out_file_size, 0);
+}
+
+void    ImFileUnmapFromMemory(void* data, size_t file_size, bool is_mapped)
+{
+    if (data == NULL)
+        return;
+    if (!is_mapped)
+    {
+        IM_FREE(data);
+        return;
+    }
+#if !defined(IMGUI_DISABLE_FILE_MAPPING) && defined(_WIN32)
+    IM_UNUSED(file_size);
+    ::UnmapViewOfFile(data);
+#elif !defined(IMGUI_DISABLE_FILE_MAPPING)
+    ::munmap(data, file_size);
+#else
+    IM_UNUSED(file_size);
+    IM_ASSERT(0);
+#endif
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2876,8 +3357,93 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+// Batch version of PassFilter() over lines of a large buffer indexed by ImGuiTextIndex (e.g. a log).
+// Instead of calling PassFilter() on every line, we search each term once across the whole range and map matches back
+// to lines, skipping to the next line after a match. Terms are processed in reverse order so that the first
+// matching term of each line decides its state, exactly like PassFilter().
+int ImTextFilterPassLines(const ImGuiTextFilter* filter, const char* buf, const ImGuiTextIndex* index, int line_begin, int line_end, ImBitVector* out_pass)
+{
+    IM_ASSERT(line_begin >= 0 && line_begin <= line_end && line_end <= index->LineOffsets.Size);
+    IM_ASSERT(out_pass->Storage.Size * 32 >= line_end && "Call out_pass->Create() with the number of lines first!");
+    const int* line_offsets = index->LineOffsets.Data;
+
+    // Lines not matching any term pass only if there are no grep terms
+    const bool pass_default = (filter->CountGrep == 0);
+    for (int line_n = line_begin; line_n < line_end; line_n++)
+        if (pass_default)
+            out_pass->SetBit(line_n);
+        else
+            out_pass->ClearBit(line_n);
+    if (line_begin == line_end || !filter->IsActive())
+        return pass_default ? line_end - line_begin : 0;
+
+    const char* text_begin = buf + line_offsets[line_begin];
+    const char* text_end = buf + ((line_end < index->LineOffsets.Size) ? line_offsets[line_end] - 1 : index->EndOffset);
+    for (int filter_n = filter->Filters.Size - 1; filter_n >= 0; filter_n--)
+    {
+        const ImGuiTextFilter::ImGuiTextRange& f = filter->Filters[filter_n];
+        if (f.empty())
+            continue;
+        const bool is_subtract = (f.b[0] == '-');
+        int line_n = line_begin;
+        for (const char* p = text_begin; p < text_end; )
+        {
+            const char* match = ImStristr(p, text_end, is_subtract ? f.b + 1 : f.b, f.e);
+            if (match == NULL)
+                break;
+
+            // Find line containing match
+            const int match_offset = (int)(match - buf);
+            int lo = line_n, hi = line_end - 1;
+            while (lo < hi)
+            {
+                const int mid = (lo + hi + 1) >> 1;
+                if (line_offsets[mid] <= match_offset)
+                    lo = mid;
+                else
+                    hi = mid - 1;
+            }
+            if (is_subtract)
+                out_pass->ClearBit(lo);
+            else
+                out_pass->SetBit(lo);
+
+            // Skip to next line
+            line_n = lo + 1;
+            if (line_n >= line_end)
+                break;
+            p = buf + line_offsets[line_n];
+        }
+    }
+
+    int pass_count = 0;
+    for (int line_n = line_begin; line_n < line_end; line_n++)
+        pass_count += out_pass->TestBit(line_n) ? 1 : 0;
+    return pass_count;
+}
+
+// Batch version of PassFilter() over an array of zero-terminated strings.
+int ImTextFilterPassStrings(const ImGuiTextFilter* filter, const char* const* texts, int texts_count, ImBitVector* out_pass)
+{
+    IM_ASSERT(out_pass->Storage.Size * 32 >= texts_count && "Call out_pass->Create() with the number of strings first!");
+    int pass_count = 0;
+    for (int n = 0; n < texts_count; n++)
+    {
+        if (filter->PassFilter(texts[n]))
+        {
+            out_pass->SetBit(n);
+            pass_count++;
+        }
+        else
+        {
+            out_pass->ClearBit(n);
+        }
+    }
+    return pass_count;
+}
+
 //-----------------------------------------------------------------------------
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImGuiTextRingBuffer
 //-----------------------------------------------------------------------------
 
 // On some platform vsnprintf() takes va_list by reference and modifies it.
@@ -2924,15 +3490,35 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     va_list args_copy;
     va_copy(args_copy, args);
 
-    int len = ImFormatStringV(NULL, 0, fmt, args);         // FIXME-OPT: could do a first pass write attempt, likely successful on first pass.
-    if (len <= 0)
+    // Add zero-terminator the first time
+    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
+
+    // First pass: write directly into available capacity, which is likely to succeed for small appends.
+    // ImFormatStringV() returns a truncated length when output doesn't fit, in which case we grow and format again.
+    const int avail = Buf.Capacity - (write_off - 1);
+    int len = (avail > 1) ? ImFormatStringV(&Buf.Data[write_off - 1], (size_t)avail, fmt, args) : 0;
+    if (avail > 1 && len < avail - 1)
     {
+        if (len > 0)
+            Buf.resize(write_off + len);
+        else if (Buf.Size != 0)
+            Buf.Data[write_off - 1] = 0;
         va_end(args_copy);
         return;
     }
+    if (Buf.Size != 0)
+        Buf.Data[write_off - 1] = 0; // Restore zero-terminator overwritten by first pass
+
+    va_list args_copy2;
+    va_copy(args_copy2, args_copy);
+    len = ImFormatStringV(NULL, 0, fmt, args_copy);
+    va_end(args_copy);
+    if (len <= 0)
+    {
+        va_end(args_copy2);
+        return;
+    }
 
-    // Add zero-terminator the first time
-    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
@@ -2941,8 +3527,8 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     }
 
     Buf.resize(needed_sz);
-    ImFormatStringV(&Buf[write_off - 1], (size_t)len + 1, fmt, args_copy);
-    va_end(args_copy);
+    ImFormatStringV(&Buf[write_off - 1], (size_t)len + 1, fmt, args_copy2);
+    va_end(args_copy2);
 }
 
 void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
@@ -2959,6 +3545,190 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
     EndOffset = ImMax(EndOffset, new_size);
 }
 
+// Set capacity. Storage is allocated on demand by append_line().
+void ImGuiTextRingBuffer::Create(int buf_size, int max_lines)
+{
+    IM_ASSERT(buf_size > 0 && max_lines > 0);
+    BufCapacity = buf_size;
+    LinesCapacity = max_lines;
+    Buf.clear();
+    Lines.clear();
+    Clear();
+}
+
+// Split text into lines. Text after the last '\n' is stored as a line which the next call continues.
+void ImGuiTextRingBuffer::append(const char* text, const char* text_end, ImU32 flags)
+{
+    for (const char* line = text; line < text_end; )
+    {
+        const char* line_end = (const char*)memchr(line, '\n', text_end - line);
+        const bool has_eol = (line_end != NULL);
+        if (!has_eol)
+            line_end = text_end;
+        if (LastLineOpen && LinesCount > 0)
+        {
+            // Remove last line (which always ends at WriteOffset) and store it again followed by new text
+            const ImGuiTextRingLine last_line = Lines.Data[(LinesHead + LinesCount - 1) % Lines.Size];
+            const int line_len = (int)(line_end - line);
+            TempBuf.resize(last_line.Length + line_len);
+            memcpy(TempBuf.Data, Buf.Data + last_line.Offset, (size_t)last_line.Length);
+            memcpy(TempBuf.Data + last_line.Length, line, (size_t)line_len);
+            LinesCount--;
+            WriteOffset = last_line.Offset;
+            append_line(TempBuf.begin(), TempBuf.end(), last_line.Flags | flags);
+        }
+        else
+        {
+            append_line(line, line_end, flags);
+        }
+        LastLineOpen = !has_eol;
+        line = line_end + 1;
+    }
+}
+
+void ImGuiTextRingBuffer::append_line(const char* line, const char* line_end, ImU32 flags)
+{
+    IM_ASSERT(IsCreated());
+    const int line_len = ImMin((int)(line_end - line), BufCapacity - 1);
+    const int store_size = line_len + 1; // Store trailing '\n' so stored lines are never empty (and may be copied along with it)
+
+    // Grow storage until capacity is reached. Text data never wraps before that, so it can be resized in place.
+    if (WriteOffset + store_size > Buf.Size && Buf.Size < BufCapacity)
+        Buf.resize(ImMin(ImMax(ImMax(Buf.Size * 2, WriteOffset + store_size), 4096), BufCapacity));
+    if (LinesCount == Lines.Size && Lines.Size < LinesCapacity)
+    {
+        // Line index may wrap (after text data evictions): unwrap it into the new storage.
+        ImVector<ImGuiTextRingLine> new_lines;
+        new_lines.resize(ImMin(ImMax(Lines.Size * 2, 256), LinesCapacity));
+        for (int n = 0; n < LinesCount; n++)
+            new_lines.Data[n] = get_line(n);
+        Lines.swap(new_lines);
+        LinesHead = 0;
+    }
+
+    // Evict oldest lines until there is room at WriteOffset. Live data spans from oldest line to WriteOffset, possibly wrapping.
+    if (LinesCount == Lines.Size)
+    {
+        LinesHead = (LinesHead + 1) % Lines.Size;
+        LinesCount--;
+        EvictedCount++;
+    }
+    while (LinesCount > 0)
+    {
+        const int oldest_offset = Lines.Data[LinesHead].Offset;
+        if (WriteOffset > oldest_offset)
+        {
+            // Free space is [WriteOffset,end) + [0,oldest_offset)
+            if (WriteOffset + store_size <= Buf.Size)
+                break;
+            WriteOffset = 0;
+            continue;
+        }
+        // Free space is [WriteOffset,oldest_offset)
+        if (WriteOffset + store_size <= oldest_offset)
+            break;
+        LinesHead = (LinesHead + 1) % Lines.Size;
+        LinesCount--;
+        EvictedCount++;
+    }
+    if (LinesCount == 0 && WriteOffset + store_size > Buf.Size)
+        WriteOffset = 0;
+
+    ImGuiTextRingLine& dst = Lines.Data[(LinesHead + LinesCount) % Lines.Size];
+    dst.Offset = WriteOffset;
+    dst.Length = line_len;
+    dst.Flags = flags;
+    memcpy(Buf.Data + WriteOffset, line, (size_t)line_len);
+    Buf.Data[WriteOffset + line_len] = '\n';
+    WriteOffset += store_size;
+    LinesCount++;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImFrameArena
+//-----------------------------------------------------------------------------
+
+void* ImFrameArena::Alloc(size_t size)
+{
+    IM_ASSERT(size < 0x7FFFFFF0);
+    if (size >= (size_t)HeapAllocSizeMin)
+    {
+        void* ptr = IM_ALLOC(size);
+        HeapAllocs.push_back(ptr);
+        return ptr;
+    }
+    const int sz = (int)IM_MEMALIGN(size, 16);
+    while (CurrBlock < Blocks.Size && CurrOffset + sz > Blocks[CurrBlock].Size)
+    {
+        // Move to next block. Remaining space in current block is wasted until next Reset().
+        CurrBlock++;
+        CurrOffset = 0;
+    }
+    if (CurrBlock == Blocks.Size)
+    {
+        Block block;
+        block.Size = ImMax(BlockSizeMin, sz);
+        block.Data = (char*)IM_ALLOC((size_t)block.Size);
+        Blocks.push_back(block);
+        ReservedBytes += block.Size;
+        CurrOffset = 0;
+    }
+    void* ptr = Blocks[CurrBlock].Data + CurrOffset;
+    CurrOffset += sz;
+    UsedBytes += sz;
+    return ptr;
+}
+
+void ImFrameArena::Reset(double time, float compact_timer)
+{
+    for (void* ptr : HeapAllocs)
+        IM_FREE(ptr);
+    HeapAllocsPrevFrame = HeapAllocs.Size;
+    HeapAllocs.resize(0);
+    UsedBytesHighWaterMark = ImMax(UsedBytesHighWaterMark, UsedBytes);
+    UsedBytesCompactMax = ImMax(UsedBytesCompactMax, UsedBytes);
+
+    // Merge blocks so the next frame can be served from a single block.
+    // Periodically shrink it to fit the largest frame since last check, so a single busy frame doesn't keep memory reserved forever.
+    int new_block_size = (Blocks.Size > 1) ? ReservedBytes : -1;
+    if (compact_timer >= 0.0f && time - CompactTime >= compact_timer)
+    {
+        const int compact_size = ((UsedBytesCompactMax + BlockSizeMin - 1) / BlockSizeMin) * BlockSizeMin;
+        if (compact_size < ReservedBytes)
+            new_block_size = compact_size;
+        UsedBytesCompactMax = 0;
+        CompactTime = time;
+    }
+    if (new_block_size >= 0)
+    {
+        ClearFreeMemory();
+        if (new_block_size > 0)
+        {
+            Block block;
+            block.Size = new_block_size;
+            block.Data = (char*)IM_ALLOC((size_t)block.Size);
+            Blocks.push_back(block);
+            ReservedBytes = block.Size;
+        }
+    }
+    UsedBytesPrevFrame = UsedBytes;
+    UsedBytes = 0;
+    CurrBlock = CurrOffset = 0;
+    FrameCount++;
+}
+
+void ImFrameArena::ClearFreeMemory()
+{
+    for (Block& block : Blocks)
+        IM_FREE(block.Data);
+    Blocks.clear();
+    for (void* ptr : HeapAllocs)
+        IM_FREE(ptr);
+    HeapAllocs.clear();
+    ReservedBytes = 0;
+    CurrBlock = CurrOffset = 0;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 //-----------------------------------------------------------------------------
@@ -3884,6 +4654,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     Time = 0.0f;
     FrameCount = 0;
     FrameCountEnded = FrameCountRendered = -1;
+    NextRefreshDelay = 0.0f;
     WithinEndChildID = 0;
     WithinFrameScope = WithinFrameScopeWithImplicitWindow = false;
     GcCompactAll = false;
@@ -3893,8 +4664,10 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
 
     InputEventsNextMouseSource = ImGuiMouseSource_Mouse;
     InputEventsNextEventId = 1;
+    InputEventsThreadQueue = NULL;
 
     WindowsActiveCount = 0;
+    WindowsHitTestDataValid = false;
     CurrentWindow = NULL;
     HoveredWindow = NULL;
     HoveredWindowUnderMovingWindow = NULL;
@@ -4065,6 +4838,8 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     DebugLogFlags = ImGuiDebugLogFlags_EventError | ImGuiDebugLogFlags_OutputToTTY;
     DebugLocateId = 0;
     DebugLogSkippedErrors = 0;
+    DebugLogCurrentCategory = ImGuiDebugLogFlags_None;
+    DebugLogViewFilter = ImGuiDebugLogFlags_EventMask_;
     DebugLogAutoDisableFlags = ImGuiDebugLogFlags_None;
     DebugLogAutoDisableFrames = 0;
     DebugLocateFrames = 0;
@@ -4147,11 +4922,14 @@ void ImGui::Shutdown()
     // The fonts atlas can be used prior to calling NewFrame(), so we clear it even if g.Initialized is FALSE (which would happen if we never called NewFrame)
     if (g.IO.Fonts && g.FontAtlasOwnedByContext)
     {
-        g.IO.Fonts->Locked = false;
+        g.IO.Fonts->Locked = g.IO.Fonts->LockedShared = false;
         IM_DELETE(g.IO.Fonts);
     }
     g.IO.Fonts = NULL;
     g.DrawListSharedData.TempBuffer.clear();
+#ifdef IMGUI_ENABLE_INPUT_THREAD_QUEUE
+    DestroyInputEventThreadQueue(&g);
+#endif
 
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
     if (!g.Initialized)
@@ -4167,6 +4945,8 @@ void ImGui::Shutdown()
     g.Windows.clear_delete();
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
+    g.WindowsHitTestData.clear();
+    g.WindowsHitTestDataValid = false;
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
@@ -4201,6 +4981,13 @@ void ImGui::Shutdown()
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
+    g.PlotTempBuffer.clear();
+#ifdef IMGUI_ENABLE_PROFILER
+    for (ImGuiProfilerFrame& frame : g.Profiler.Frames)
+        frame.Events.clear();
+    g.Profiler.Stack.clear();
+#endif
+    g.FrameArena.ClearFreeMemory();
     g.InputTextState.ClearFreeMemory();
     g.InputTextDeactivatedState.ClearFreeMemory();
 
@@ -4216,8 +5003,8 @@ void ImGui::Shutdown()
         g.LogFile = NULL;
     }
     g.LogBuffer.clear();
-    g.DebugLogBuf.clear();
-    g.DebugLogIndex.clear();
+    g.DebugLogRing.ClearFreeMemory();
+    g.DebugLogLineBuf.clear();
 
     g.Initialized = false;
 }
@@ -4312,6 +5099,7 @@ void ImGui::GcCompactTransientMiscBuffers()
     g.GroupStack.clear();
     g.MultiSelectTempDataStacked = 0;
     g.MultiSelectTempData.clear_destruct();
+    g.FrameArena.ClearFreeMemory();
     TableGcCompactSettings();
 }
 
@@ -4564,10 +5352,16 @@ bool ImGui::IsItemHovered(ImGuiHoveredFlags flags)
         // but once unlocked on a given item we also moving.
         //if (g.HoverDelayTimer >= delay && (g.HoverDelayTimer - g.IO.DeltaTime < delay || g.MouseStationaryTimer - g.IO.DeltaTime < g.Style.HoverStationaryDelay)) { IMGUI_DEBUG_LOG("HoverDelayTimer = %f/%f, MouseStationaryTimer = %f\n", g.HoverDelayTimer, delay, g.MouseStationaryTimer); }
         if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverItemUnlockedStationaryId != hover_delay_id)
+        {
+            RequestRefresh(g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
             return false;
+        }
 
         if (g.HoverItemDelayTimer < delay)
+        {
+            RequestRefresh(delay - g.HoverItemDelayTimer);
             return false;
+        }
     }
 
     return true;
@@ -4713,55 +5507,309 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
         wrap_pos_x += window->Pos.x - window->Scroll.x; // wrap_pos_x is provided is window local space
     }
 
-    return ImMax(wrap_pos_x - pos.x, 1.0f);
+    return ImMax(wrap_pos_x - pos.x, 1.0f);
+}
+
+// IM_ALLOC() == ImGui::MemAlloc()
+void* ImGui::MemAlloc(size_t size)
+{
+    return MemAllocEx(size, "(unknown)", 0);
+}
+
+// IM_ALLOC() == ImGui::MemAllocEx(size, __FILE__, __LINE__) when IMGUI_DEBUG_ALLOC_CALLSITES is defined
+void* ImGui::MemAllocEx(size_t size, const char* file, int line)
+{
+    void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (ImGuiContext* ctx = GImGui)
+    {
+        DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+#ifdef IMGUI_DEBUG_ALLOC_CALLSITES
+        DebugAllocHookCallSite(&ctx->DebugAllocInfo, ctx->FrameCount, size, file, line, ctx->CurrentWindow ? ctx->CurrentWindow->ID : 0);
+#endif
+    }
+#endif
+    IM_UNUSED(file);
+    IM_UNUSED(line);
+    return ptr;
+}
+
+// IM_FREE() == ImGui::MemFree()
+void ImGui::MemFree(void* ptr)
+{
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    if (ptr != NULL)
+        if (ImGuiContext* ctx = GImGui)
+            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
+#endif
+    return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
+}
+
+// We record the number of allocation in recent frames, as a way to audit/sanitize our guiding principles of "no allocations on idle/repeating frames"
+void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size)
+{
+    ImGuiDebugAllocEntry* entry = &info->LastEntriesBuf[info->LastEntriesIdx];
+    IM_UNUSED(ptr);
+    if (entry->FrameCount != frame_count)
+    {
+        info->LastEntriesIdx = (info->LastEntriesIdx + 1) % IM_ARRAYSIZE(info->LastEntriesBuf);
+        entry = &info->LastEntriesBuf[info->LastEntriesIdx];
+        entry->FrameCount = frame_count;
+        entry->AllocCount = entry->FreeCount = 0;
+    }
+    if (size != (size_t)-1)
+    {
+        //printf("[%05d] MemAlloc(%d) -> 0x%p\n", frame_count, (int)size, ptr);
+        entry->AllocCount++;
+        info->TotalAllocCount++;
+    }
+    else
+    {
+        //printf("[%05d] MemFree(0x%p)\n", frame_count, ptr);
+        entry->FreeCount++;
+        info->TotalFreeCount++;
+    }
+}
+
+// Aggregate allocations per call-site. Only enabled with IMGUI_DEBUG_ALLOC_CALLSITES, see 'Metrics->Memory allocations->Call sites'.
+// We use a fixed-size table so that recording never allocates.
+void ImGui::DebugAllocHookCallSite(ImGuiDebugAllocInfo* info, int frame_count, size_t size, const char* file, int line, ImGuiID window_id)
+{
+#ifdef IMGUI_DEBUG_ALLOC_CALLSITES
+    // Same file may be reported with different __FILE__ pointers from different compilation units, so we hash and compare contents.
+    const int table_size = IM_ARRAYSIZE(info->CallSites);
+    const ImGuiID hash = ImHashStr(file, 0, (ImGuiID)line);
+    ImGuiDebugAllocCallSite* site = NULL;
+    for (int n = 0, idx = (int)(hash % (ImGuiID)table_size); n < table_size; n++, idx = (idx + 1) % table_size)
+    {
+        ImGuiDebugAllocCallSite* candidate = &info->CallSites[idx];
+        if (candidate->File == NULL)
+        {
+            if (info->CallSitesCount >= table_size * 3 / 4)
+                break;
+            candidate->File = file;
+            candidate->Line = line;
+            candidate->LastFrame = -1;
+            info->CallSitesCount++;
+            site = candidate;
+            break;
+        }
+        if (candidate->Line == line && (candidate->File == file || strcmp(candidate->File, file) == 0))
+        {
+            site = candidate;
+            break;
+        }
+    }
+    if (site == NULL)
+    {
+        info->CallSitesOverflowCount++;
+        return;
+    }
+    if (site->LastFrame != frame_count)
+    {
+        site->LastFrame = frame_count;
+        site->LastFrameAllocCount = site->LastFrameAllocBytes = 0;
+        site->FramesWithAllocsCount++;
+    }
+    site->LastWindowID = window_id;
+    site->TotalAllocCount++;
+    site->TotalAllocBytes += size;
+    site->LastFrameAllocCount++;
+    site->LastFrameAllocBytes += (int)size;
+#else
+    IM_UNUSED(info); IM_UNUSED(frame_count); IM_UNUSED(size); IM_UNUSED(file); IM_UNUSED(line); IM_UNUSED(window_id);
+#endif
+}
+
+#ifdef IMGUI_DEBUG_ALLOC_CALLSITES
+static int IMGUI_CDECL DebugAllocCallSiteComparerByTotalBytes(const void* lhs, const void* rhs)
+{
+    const ImGuiDebugAllocCallSite* a = *(const ImGuiDebugAllocCallSite* const*)lhs;
+    const ImGuiDebugAllocCallSite* b = *(const ImGuiDebugAllocCallSite* const*)rhs;
+    return (a->TotalAllocBytes < b->TotalAllocBytes) ? +1 : (a->TotalAllocBytes > b->TotalAllocBytes) ? -1 : 0;
+}
+
+static const char* DebugAllocCallSiteGetFilename(const char* path)
+{
+    const char* filename = path;
+    for (const char* p = path; *p; p++)
+        if (*p == '/' || *p == '\\')
+            filename = p + 1;
+    return filename;
+}
+#endif
+
+// Output a text report of call-sites sorted by total allocated bytes.
+void ImGui::DebugAllocCallSitesReport(ImGuiDebugAllocInfo* info, ImGuiTextBuffer* out_buf)
+{
+#ifdef IMGUI_DEBUG_ALLOC_CALLSITES
+    ImGuiContext& g = *GImGui;
+    ImVector<ImGuiDebugAllocCallSite*> sites;
+    for (ImGuiDebugAllocCallSite& site : info->CallSites)
+        if (site.File != NULL)
+            sites.push_back(&site);
+    if (sites.Size > 1)
+        ImQsort(sites.Data, (size_t)sites.Size, sizeof(ImGuiDebugAllocCallSite*), DebugAllocCallSiteComparerByTotalBytes);
+    out_buf->appendf("Dear ImGui allocations by call-site, frame %d (%d sites, %d overflowed allocations)\n", g.FrameCount, info->CallSitesCount, info->CallSitesOverflowCount);
+    out_buf->appendf("%-40s %10s %12s %8s %12s %s\n", "File:Line", "Allocs", "Bytes", "Frames", "LastFrame", "LastWindow");
+    for (ImGuiDebugAllocCallSite* site : sites)
+    {
+        ImGuiWindow* window = site->LastWindowID ? FindWindowByID(site->LastWindowID) : NULL;
+        char file_line[64];
+        ImFormatString(file_line, IM_ARRAYSIZE(file_line), "%s:%d", DebugAllocCallSiteGetFilename(site->File), site->Line);
+        out_buf->appendf("%-40s %10d %12llu %8d %12d %s\n", file_line, site->TotalAllocCount, (unsigned long long)site->TotalAllocBytes, site->FramesWithAllocsCount, site->LastFrame, window ? window->Name : "");
+    }
+#else
+    IM_UNUSED(info);
+    out_buf->append("Call-sites recording is disabled. #define IMGUI_DEBUG_ALLOC_CALLSITES in your imconfig.h file to enable.\n");
+#endif
+}
+
+#ifdef IMGUI_ENABLE_PROFILER
+static ImU64 DebugProfilerGetTimeNs()
+{
+    return (ImU64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void DebugProfilerGetOwnerName(ImGuiID owner_id, char* buf, int buf_size)
+{
+    buf[0] = 0;
+    if (owner_id == 0)
+        return;
+    if (ImGuiWindow* window = ImGui::FindWindowByID(owner_id))
+        ImFormatString(buf, (size_t)buf_size, "%s", window->Name);
+    else if (ImGuiTable* table = ImGui::TableFindByID(owner_id))
+        ImFormatString(buf, (size_t)buf_size, "%s/Table 0x%08X", table->OuterWindow ? table->OuterWindow->Name : "", owner_id);
+    else
+        ImFormatString(buf, (size_t)buf_size, "0x%08X", owner_id);
 }
+#endif
 
-// IM_ALLOC() == ImGui::MemAlloc()
-void* ImGui::MemAlloc(size_t size)
+// Called at the very beginning of NewFrame(): close previous frame and start recording a new one.
+void ImGui::DebugProfilerNewFrame()
 {
-    void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
-#ifndef IMGUI_DISABLE_DEBUG_TOOLS
-    if (ImGuiContext* ctx = GImGui)
-        DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    if (profiler->Recording)
+    {
+        // Close events left open (e.g. missing End() calls)
+        ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+        for (int event_idx : profiler->Stack)
+            frame->Events[event_idx].TimeEnd = frame->TimeEnd;
+        profiler->FrameIdx = (profiler->FrameIdx + 1) % IMGUI_PROFILER_FRAMES_COUNT;
+    }
+    profiler->Stack.resize(0);
+    profiler->Recording = !profiler->Paused;
+    if (profiler->Recording)
+    {
+        ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+        frame->FrameCount = g.FrameCount + 1;
+        frame->TimeBegin = frame->TimeEnd = DebugProfilerGetTimeNs();
+        frame->Events.resize(0);
+    }
 #endif
-    return ptr;
 }
 
-// IM_FREE() == ImGui::MemFree()
-void ImGui::MemFree(void* ptr)
+void ImGui::DebugProfilerBeginEvent(const char* name, ImGuiID owner_id)
 {
-#ifndef IMGUI_DISABLE_DEBUG_TOOLS
-    if (ptr != NULL)
-        if (ImGuiContext* ctx = GImGui)
-            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    if (!profiler->Recording)
+        return;
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+    profiler->Stack.push_back(frame->Events.Size);
+    frame->Events.resize(frame->Events.Size + 1);
+    ImGuiProfilerEvent* event = &frame->Events.back();
+    event->Name = name;
+    event->OwnerID = owner_id;
+    event->Depth = profiler->Stack.Size - 1;
+    event->TimeBegin = event->TimeEnd = DebugProfilerGetTimeNs();
+#else
+    IM_UNUSED(name); IM_UNUSED(owner_id);
 #endif
-    return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
-// We record the number of allocation in recent frames, as a way to audit/sanitize our guiding principles of "no allocations on idle/repeating frames"
-void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size)
+// Close the most recent open event with same name/owner.
+// Events opened after it and not closed yet (e.g. because of error recovery) are closed at the same time.
+void ImGui::DebugProfilerEndEvent(const char* name, ImGuiID owner_id)
 {
-    ImGuiDebugAllocEntry* entry = &info->LastEntriesBuf[info->LastEntriesIdx];
-    IM_UNUSED(ptr);
-    if (entry->FrameCount != frame_count)
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    if (!profiler->Recording)
+        return;
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+    for (int n = profiler->Stack.Size - 1; n >= 0; n--)
     {
-        info->LastEntriesIdx = (info->LastEntriesIdx + 1) % IM_ARRAYSIZE(info->LastEntriesBuf);
-        entry = &info->LastEntriesBuf[info->LastEntriesIdx];
-        entry->FrameCount = frame_count;
-        entry->AllocCount = entry->FreeCount = 0;
+        const ImGuiProfilerEvent* event = &frame->Events[profiler->Stack[n]];
+        if (event->Name != name || event->OwnerID != owner_id)
+            continue;
+        const ImU64 time = DebugProfilerGetTimeNs();
+        for (int m = n; m < profiler->Stack.Size; m++)
+            frame->Events[profiler->Stack[m]].TimeEnd = time;
+        profiler->Stack.resize(n);
+        frame->TimeEnd = time;
+        return;
     }
-    if (size != (size_t)-1)
+#else
+    IM_UNUSED(name); IM_UNUSED(owner_id);
+#endif
+}
+
+#ifdef IMGUI_ENABLE_PROFILER
+static void DebugProfilerAppendJsonString(ImGuiTextBuffer* out_buf, const char* str)
+{
+    out_buf->append("\"");
+    for (const char* p = str; *p; p++)
     {
-        //printf("[%05d] MemAlloc(%d) -> 0x%p\n", frame_count, (int)size, ptr);
-        entry->AllocCount++;
-        info->TotalAllocCount++;
+        if (*p == '"' || *p == '\\')
+            out_buf->appendf("\\%c", *p);
+        else if ((unsigned char)*p < 0x20)
+            out_buf->appendf("\\u%04x", (unsigned char)*p);
+        else
+            out_buf->append(p, p + 1);
     }
-    else
+    out_buf->append("\"");
+}
+#endif
+
+// Output completed frames in Chrome trace event format (JSON), which may be loaded in chrome://tracing or https://ui.perfetto.dev
+void ImGui::DebugProfilerExportChromeTrace(ImGuiTextBuffer* out_buf)
+{
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.Profiler;
+    ImU64 time_origin = 0;
+    for (const ImGuiProfilerFrame& frame : profiler->Frames)
+        if (frame.FrameCount != 0 && (time_origin == 0 || frame.TimeBegin < time_origin))
+            time_origin = frame.TimeBegin;
+
+    out_buf->append("{\"traceEvents\":[\n");
+    bool first_event = true;
+    for (int n = 1; n <= IMGUI_PROFILER_FRAMES_COUNT; n++)
     {
-        //printf("[%05d] MemFree(0x%p)\n", frame_count, ptr);
-        entry->FreeCount++;
-        info->TotalFreeCount++;
+        // Oldest to newest, skipping frame being recorded
+        const int frame_idx = (profiler->FrameIdx + n) % IMGUI_PROFILER_FRAMES_COUNT;
+        const ImGuiProfilerFrame* frame = &profiler->Frames[frame_idx];
+        if (frame->FrameCount == 0 || (frame_idx == profiler->FrameIdx && profiler->Recording))
+            continue;
+        for (const ImGuiProfilerEvent& event : frame->Events)
+        {
+            char owner_name[128];
+            DebugProfilerGetOwnerName(event.OwnerID, owner_name, IM_ARRAYSIZE(owner_name));
+            out_buf->appendf("%s{\"name\":", first_event ? "" : ",\n");
+            DebugProfilerAppendJsonString(out_buf, owner_name[0] ? owner_name : event.Name);
+            out_buf->appendf(",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%d}}",
+                event.Name, (double)(event.TimeBegin - time_origin) / 1000.0, (double)(event.TimeEnd - event.TimeBegin) / 1000.0, frame->FrameCount);
+            first_event = false;
+        }
     }
+    out_buf->append("\n],\"displayTimeUnit\":\"ms\"}\n");
+#else
+    out_buf->append("{\"traceEvents\":[]}\n");
+#endif
 }
 
 const char* ImGui::GetClipboardText()
@@ -4819,6 +5867,14 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+// Request output to be refreshed within 'delay' seconds, even if no new inputs are received.
+// Only affects the value of io.NextRefreshDelay reported by EndFrame(): it is up to the application main loop to use it.
+void ImGui::RequestRefresh(float delay)
+{
+    ImGuiContext& g = *GImGui;
+    g.NextRefreshDelay = ImMin(g.NextRefreshDelay, ImMax(delay, 0.0f));
+}
+
 static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -5090,7 +6146,7 @@ static void SetupDrawListSharedData()
     g.DrawListSharedData.InitialFlags = ImDrawListFlags_None;
     if (g.Style.AntiAliasedLines)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLines;
-    if (g.Style.AntiAliasedLinesUseTex && !(g.IO.Fonts->Flags & ImFontAtlasFlags_NoBakedLines))
+    if (g.Style.AntiAliasedLinesUseTex && !(g.IO.Fonts->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SDF)))
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
@@ -5102,6 +6158,8 @@ void ImGui::NewFrame()
 {
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
+    DebugProfilerNewFrame();
+    IMGUI_PROFILER_BEGIN("NewFrame", 0);
 
     // Remove pending delete hooks before frame start.
     // This deferred removal avoid issues of removal while iterating the hook vector
@@ -5120,6 +6178,8 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    g.FrameArena.Reset(g.Time, g.IO.ConfigMemoryCompactTimer);
+    g.NextRefreshDelay = FLT_MAX;
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -5139,7 +6199,9 @@ void ImGui::NewFrame()
     UpdateViewportsNewFrame();
 
     // Setup current font and draw list shared data
-    g.IO.Fonts->Locked = true;
+    // (an atlas shared between threads is permanently locked, we don't touch it)
+    if (!g.IO.Fonts->LockedShared)
+        g.IO.Fonts->Locked = true;
     SetupDrawListSharedData();
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
@@ -5342,6 +6404,7 @@ void ImGui::NewFrame()
     // Create implicit/fallback window - which we will only render it if the user has added something to it.
     // We don't use "Debug" to avoid colliding with user trying to create a "Debug" window with custom flags.
     // This fallback is particularly important as it prevents ImGui:: calls from crashing.
+    IMGUI_PROFILER_END("NewFrame", 0);
     g.WithinFrameScopeWithImplicitWindow = true;
     SetNextWindowSize(ImVec2(400, 400), ImGuiCond_FirstUseEver);
     Begin("Debug##Default");
@@ -5556,6 +6619,45 @@ static void ImGui::RenderDimmedBackgrounds()
     }
 }
 
+// Calculate io.NextRefreshDelay: how long the application may wait for new inputs before output would change.
+// We are deliberately conservative: anything that may settle over the next frame(s) requests an immediate refresh.
+// Time-based features (cursor blink, hover delays, settings save timer, user animations) call RequestRefresh() with a delay.
+void ImGui::UpdateNextRefreshDelay()
+{
+    ImGuiContext& g = *GImGui;
+    if (g.SettingsDirtyTimer > 0.0f)
+        RequestRefresh(g.SettingsDirtyTimer);
+    if (g.NavHighlightActivatedTimer > 0.0f)
+        RequestRefresh(g.NavHighlightActivatedTimer);
+
+    // Inputs processed this frame, or still queued (e.g. trickled)
+    bool refresh = (g.InputEventsTrail.Size > 0 || g.InputEventsQueue.Size > 0);
+
+    // Held mouse buttons and keys (key repeat, drag thresholds, timers)
+    for (int n = 0; n < IM_ARRAYSIZE(g.IO.MouseDown) && !refresh; n++)
+        refresh |= g.IO.MouseDown[n];
+    for (ImGuiKey key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END && !refresh; key = (ImGuiKey)(key + 1))
+        if (!IsLRModKey(key) && !(key >= ImGuiKey_ReservedForModCtrl && key <= ImGuiKey_ReservedForModSuper))
+            refresh |= g.IO.KeysData[key - ImGuiKey_NamedKey_BEGIN].Down;
+
+    // Interactions and state changes settling over next frame(s). A focused InputText only needs its cursor blink (see InputTextEx()).
+    refresh |= (g.ActiveId != 0 && g.ActiveId != g.InputTextState.ID) || (g.ActiveId != g.ActiveIdPreviousFrame) || (g.HoveredId != g.HoveredIdPreviousFrame);
+    refresh |= g.DragDropActive || g.IO.WantSetMousePos || g.NavWindowingTarget != NULL || (g.NavWindowingHighlightAlpha > 0.0f && g.NavWindowingHighlightAlpha < 1.0f);
+    refresh |= g.NavInitRequest || g.NavMoveSubmitted || g.NavMoveForwardToNextFrame || g.NavNextActivateId != 0;
+    refresh |= (g.DimBgRatio > 0.0f && g.DimBgRatio < 1.0f);
+    for (int n = 0; n < g.Windows.Size && !refresh; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        if (!window->Active && !window->WasActive)
+            continue;
+        refresh |= (window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0);
+        refresh |= (window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0);
+        refresh |= (window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX);
+    }
+
+    g.IO.NextRefreshDelay = refresh ? 0.0f : g.NextRefreshDelay;
+}
+
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
@@ -5590,6 +6692,8 @@ void ImGui::EndFrame()
         g.CurrentWindow->Active = false;
     End();
 
+    IMGUI_PROFILER_SCOPE("EndFrame", 0);
+
     // Update navigation: CTRL+Tab, wrap-around requests
     NavEndFrame();
 
@@ -5635,10 +6739,29 @@ void ImGui::EndFrame()
     // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
     IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
     g.Windows.swap(g.WindowsTempSortBuffer);
+
+    // Build compact hit-testing data for next frame's FindHoveredWindowEx()
+    // (windows which are active now will have WasActive set during next NewFrame())
+    g.WindowsHitTestData.resize(0);
+    for (ImGuiWindow* window : g.Windows)
+    {
+        if (!window->Active || window->Hidden || (window->Flags & ImGuiWindowFlags_NoMouseInputs))
+            continue;
+        ImGuiWindowHitTestData data;
+        data.Rect = window->OuterRectClipped;
+        data.Window = window;
+        data.UseResizePadding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) == 0;
+        g.WindowsHitTestData.push_back(data);
+    }
+    g.WindowsHitTestDataValid = true;
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
+    // Report when output may next change without new inputs, so application can skip idle frames
+    UpdateNextRefreshDelay();
+
     // Unlock font atlas
-    g.IO.Fonts->Locked = false;
+    if (!g.IO.Fonts->LockedShared)
+        g.IO.Fonts->Locked = false;
 
     // Clear Input data for next frame
     g.IO.MousePosPrev = g.IO.MousePos;
@@ -5662,6 +6785,7 @@ void ImGui::Render()
     if (g.FrameCountRendered == g.FrameCount)
         return;
     g.FrameCountRendered = g.FrameCount;
+    IMGUI_PROFILER_SCOPE("Render", 0);
 
     g.IO.MetricsRenderWindows = 0;
     CallContextHooks(&g, ImGuiContextHookType_RenderPre);
@@ -5761,21 +6885,36 @@ void ImGui::FindHoveredWindowEx(const ImVec2& pos, bool find_first_and_in_any_vi
     if (find_first_and_in_any_viewport == false && g.MovingWindow && !(g.MovingWindow->Flags & ImGuiWindowFlags_NoMouseInputs))
         hovered_window = g.MovingWindow;
 
+    // When possible, use compact data built by EndFrame() which only contains active windows.
+    // (the TestEngine mode may be called at any point of the frame so it always scans all windows)
+    const bool use_hit_test_data = g.WindowsHitTestDataValid && !find_first_and_in_any_viewport;
+    const int windows_count = use_hit_test_data ? g.WindowsHitTestData.Size : g.Windows.Size;
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize = g.IO.ConfigWindowsResizeFromEdges ? g.WindowsHoverPadding : padding_regular;
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
+    for (int i = windows_count - 1; i >= 0; i--)
     {
-        ImGuiWindow* window = g.Windows[i];
-        IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (!window->WasActive || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
+        ImGuiWindow* window;
+        if (use_hit_test_data)
+        {
+            const ImGuiWindowHitTestData& data = g.WindowsHitTestData.Data[i];
+            if (!data.Rect.ContainsWithPad(pos, data.UseResizePadding ? padding_for_resize : padding_regular))
+                continue;
+            window = data.Window;
+        }
+        else
+        {
+            window = g.Windows[i];
+            IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
+            if (!window->WasActive || window->Hidden)
+                continue;
+            if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+                continue;
 
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize;
-        if (!window->OuterRectClipped.ContainsWithPad(pos, hit_padding))
-            continue;
+            // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+            ImVec2 hit_padding = (window->Flags & (ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? padding_regular : padding_for_resize;
+            if (!window->OuterRectClipped.ContainsWithPad(pos, hit_padding))
+                continue;
+        }
 
         // Support for one rectangular hole in any given window
         // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
@@ -6551,7 +7690,10 @@ static int ImGui::UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& si
         ButtonBehavior(border_rect, border_id, &hovered, &held, ImGuiButtonFlags_FlattenChildren | ImGuiButtonFlags_NoNavFocus);
         //GetForegroundDrawList(window)->AddRect(border_rect.Min, border_rect.Max, IM_COL32(255, 255, 0, 255));
         if (hovered && g.HoveredIdTimer <= WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER)
+        {
+            RequestRefresh(WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER - g.HoveredIdTimer);
             hovered = false;
+        }
         if (hovered || held)
             SetMouseCursor((axis == ImGuiAxis_X) ? ImGuiMouseCursor_ResizeEW : ImGuiMouseCursor_ResizeNS);
         if (held && g.IO.MouseDoubleClicked[0])
@@ -7013,6 +8155,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     const bool window_just_created = (window == NULL);
     if (window_just_created)
         window = CreateNewWindow(name, flags);
+    IMGUI_PROFILER_BEGIN("Window", window->ID);
 
     // [DEBUG] Debug break requested by user
     if (g.DebugBreakInWindow == window->ID)
@@ -7813,6 +8956,7 @@ void ImGui::End()
 
     g.CurrentWindowStack.pop_back();
     SetCurrentWindow(g.CurrentWindowStack.Size == 0 ? NULL : g.CurrentWindowStack.back().Window);
+    IMGUI_PROFILER_END("Window", window->ID);
 }
 
 void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
@@ -7839,6 +8983,7 @@ void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
 void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
+    g.WindowsHitTestDataValid = false;
     ImGuiWindow* current_front_window = g.Windows.back();
     if (current_front_window == window || current_front_window->RootWindow == window) // Cheap early out (could be better)
         return;
@@ -7854,6 +8999,7 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
 void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
+    g.WindowsHitTestDataValid = false;
     if (g.Windows[0] == window)
         return;
     for (int i = 0; i < g.Windows.Size; i++)
@@ -7869,6 +9015,7 @@ void ImGui::BringWindowToDisplayBehind(ImGuiWindow* window, ImGuiWindow* behind_
 {
     IM_ASSERT(window != NULL && behind_window != NULL);
     ImGuiContext& g = *GImGui;
+    g.WindowsHitTestDataValid = false;
     window = window->RootWindow;
     behind_window = behind_window->RootWindow;
     int pos_wnd = FindWindowDisplayIndex(window);
@@ -8737,16 +9884,32 @@ bool ImGui::IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max)
 IM_MSVC_RUNTIME_CHECKS_OFF
 ImGuiID ImGuiWindow::GetID(const char* str, const char* str_end)
 {
+    ImGuiContext& g = *Ctx;
     ImGuiID seed = IDStack.back();
-    ImGuiID id = ImHashStr(str, str_end ? (str_end - str) : 0, seed);
+    ImGuiID id;
+    if ((g.NextItemData.HasFlags & ImGuiNextItemDataFlags_HasHashedLabel) && str == g.NextItemData.HashedLabel.Str && str_end == NULL)
+        id = ImHashStr(g.NextItemData.HashedLabel, seed);
+    else
+        id = ImHashStr(str, str_end ? (str_end - str) : 0, seed);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
-    ImGuiContext& g = *Ctx;
     if (g.DebugHookIdInfo == id)
         ImGui::DebugHookIdInfo(id, ImGuiDataType_String, str, str_end);
 #endif
     return id;
 }
 
+ImGuiID ImGuiWindow::GetID(const ImGuiHashedStr& str)
+{
+    ImGuiID seed = IDStack.back();
+    ImGuiID id = ImHashStr(str, seed);
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+    ImGuiContext& g = *Ctx;
+    if (g.DebugHookIdInfo == id)
+        ImGui::DebugHookIdInfo(id, ImGuiDataType_String, str.Str, NULL);
+#endif
+    return id;
+}
+
 ImGuiID ImGuiWindow::GetID(const void* ptr)
 {
     ImGuiID seed = IDStack.back();
@@ -8822,6 +9985,14 @@ void ImGui::PushID(int int_id)
     window->IDStack.push_back(id);
 }
 
+void ImGui::PushID(const ImGuiHashedStr& str_id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiID id = window->GetID(str_id);
+    window->IDStack.push_back(id);
+}
+
 // Push a given id value ignoring the ID stack as a seed.
 void ImGui::PushOverrideID(ImGuiID id)
 {
@@ -8893,6 +10064,21 @@ ImGuiID ImGui::GetID(int int_id)
     ImGuiWindow* window = GImGui->CurrentWindow;
     return window->GetID(int_id);
 }
+
+ImGuiID ImGui::GetID(const ImGuiHashedStr& str_id)
+{
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    return window->GetID(str_id);
+}
+
+// Called by IM_HASHED_LABEL(). Next item will use the precomputed hash if it passes the same string pointer to ImGuiWindow::GetID().
+// Unlike other SetNextItemXXX() data, this is harmlessly left over if the item is not submitted: it is only used for the same literal.
+void ImGui::SetNextItemHashedLabel(const ImGuiHashedStr& label)
+{
+    ImGuiContext& g = *GImGui;
+    g.NextItemData.HasFlags |= ImGuiNextItemDataFlags_HasHashedLabel;
+    g.NextItemData.HashedLabel = label;
+}
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
 //-----------------------------------------------------------------------------
@@ -9987,6 +11173,160 @@ static void DebugPrintInputEvent(const char* prefix, const ImGuiInputEvent* e)
 }
 #endif
 
+#ifdef IMGUI_ENABLE_INPUT_THREAD_QUEUE
+
+// Bounded lock-free multiple-producers single-consumer queue.
+// Each cell has a sequence number telling producers/consumer whether it is free to write or ready to read.
+struct ImGuiInputEventThreadQueue
+{
+    struct Cell
+    {
+        std::atomic<ImU32>  Sequence;
+        ImGuiInputEvent     Event;
+    };
+    Cell*                   Cells;
+    ImU32                   Mask;                   // Capacity - 1
+    bool                    CoalesceMouseEvents;
+    ImU32                   DequeuePos;             // Only accessed by consumer (main thread)
+    std::atomic<ImU32>      EnqueuePos;
+    std::atomic<int>        DroppedCount;           // Events dropped because queue was full
+
+    bool Push(const ImGuiInputEvent* e)
+    {
+        ImU32 pos = EnqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;)
+        {
+            cell = &Cells[pos & Mask];
+            const ImU32 seq = cell->Sequence.load(std::memory_order_acquire);
+            const int diff = (int)(seq - pos);
+            if (diff == 0)
+            {
+                if (EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                DroppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                pos = EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->Event = *e;
+        cell->Sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Pop(ImGuiInputEvent* out_e)
+    {
+        Cell* cell = &Cells[DequeuePos & Mask];
+        const ImU32 seq = cell->Sequence.load(std::memory_order_acquire);
+        if ((int)(seq - (DequeuePos + 1)) < 0)
+            return false;
+        *out_e = cell->Event;
+        cell->Sequence.store(DequeuePos + Mask + 1, std::memory_order_release);
+        DequeuePos++;
+        return true;
+    }
+};
+
+void ImGui::CreateInputEventThreadQueue(ImGuiContext* ctx, int capacity, bool coalesce_mouse_events)
+{
+    IM_ASSERT(ctx->InputEventsThreadQueue == NULL && "Input event thread queue already created!");
+    IM_ASSERT(capacity > 0 && capacity <= (1 << 24));
+    ImU32 capacity_pow2 = 2;
+    while (capacity_pow2 < (ImU32)capacity)
+        capacity_pow2 <<= 1;
+
+    ImGuiInputEventThreadQueue* queue = IM_NEW(ImGuiInputEventThreadQueue)();
+    queue->Cells = (ImGuiInputEventThreadQueue::Cell*)IM_ALLOC(sizeof(ImGuiInputEventThreadQueue::Cell) * capacity_pow2);
+    for (ImU32 n = 0; n < capacity_pow2; n++)
+        IM_PLACEMENT_NEW(&queue->Cells[n]) ImGuiInputEventThreadQueue::Cell();
+    for (ImU32 n = 0; n < capacity_pow2; n++)
+        queue->Cells[n].Sequence.store(n, std::memory_order_relaxed);
+    queue->Mask = capacity_pow2 - 1;
+    queue->CoalesceMouseEvents = coalesce_mouse_events;
+    queue->DequeuePos = 0;
+    queue->EnqueuePos.store(0, std::memory_order_relaxed);
+    queue->DroppedCount.store(0, std::memory_order_relaxed);
+    ctx->InputEventsThreadQueue = queue;
+}
+
+void ImGui::DestroyInputEventThreadQueue(ImGuiContext* ctx)
+{
+    ImGuiInputEventThreadQueue* queue = ctx->InputEventsThreadQueue;
+    if (queue == NULL)
+        return;
+    for (ImU32 n = 0; n <= queue->Mask; n++)
+        queue->Cells[n].~Cell();
+    IM_FREE(queue->Cells);
+    IM_DELETE(queue);
+    ctx->InputEventsThreadQueue = NULL;
+}
+
+bool ImGui::PostInputEventThreadSafe(ImGuiContext* ctx, const ImGuiInputEvent* e)
+{
+    IM_ASSERT(ctx->InputEventsThreadQueue != NULL && "Call CreateInputEventThreadQueue() first!");
+    IM_ASSERT(e->Type > ImGuiInputEventType_None && e->Type < ImGuiInputEventType_COUNT);
+    return ctx->InputEventsThreadQueue->Push(e);
+}
+
+// Move events posted from other threads into g.InputEventsQueue[], called at the beginning of UpdateInputEvents().
+void ImGui::UpdateInputEventThreadQueue()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiInputEventThreadQueue* queue = g.InputEventsThreadQueue;
+    if (queue == NULL)
+        return;
+    if (int dropped_count = queue->DroppedCount.exchange(0, std::memory_order_relaxed))
+        IMGUI_DEBUG_LOG_IO("[io] Input event thread queue is full: dropped %d events!\n", dropped_count);
+
+    ImGuiInputEvent e;
+    while (queue->Pop(&e))
+    {
+        if (!g.IO.AppAcceptingEvents)
+            continue;
+        e.EventId = g.InputEventsNextEventId++;
+        e.TrailOnly = e.NotInTrail = false;
+
+        // Coalesce with previous event.
+        // Raw events which are folded stay in the queue as 'TrailOnly' events right before the coalesced one,
+        // so UpdateInputEvents() appends them to g.InputEventsTrail when (and only when) the coalesced event is processed.
+        ImGuiInputEvent* prev_e = g.InputEventsQueue.Size > 0 ? &g.InputEventsQueue.back() : NULL;
+        if (queue->CoalesceMouseEvents && prev_e != NULL && prev_e->Type == e.Type)
+        {
+            if (e.Type == ImGuiInputEventType_MousePos && prev_e->MousePos.MouseSource == e.MousePos.MouseSource)
+            {
+                prev_e->TrailOnly = true; // Last position is a raw event: processed and appended to the trail as usual.
+                g.InputEventsQueue.push_back(e);
+                continue;
+            }
+            if (e.Type == ImGuiInputEventType_MouseWheel && prev_e->MouseWheel.MouseSource == e.MouseWheel.MouseSource)
+            {
+                ImGuiInputEvent sum_e = *prev_e;
+                if (prev_e->NotInTrail)
+                    g.InputEventsQueue.pop_back(); // Replace previous sum
+                else
+                    prev_e->TrailOnly = true;
+                sum_e.MouseWheel.WheelX += e.MouseWheel.WheelX;
+                sum_e.MouseWheel.WheelY += e.MouseWheel.WheelY;
+                sum_e.EventId = e.EventId;
+                sum_e.NotInTrail = true; // Summed event is not a raw event
+                e.TrailOnly = true;
+                g.InputEventsQueue.push_back(e);
+                g.InputEventsQueue.push_back(sum_e);
+                continue;
+            }
+        }
+        g.InputEventsQueue.push_back(e);
+    }
+}
+
+#endif // #ifdef IMGUI_ENABLE_INPUT_THREAD_QUEUE
+
 // Process input queue
 // We always call this with the value of 'bool g.IO.ConfigInputTrickleEventQueue'.
 // - trickle_fast_inputs = false : process all events, turn into flattened input state (e.g. successive down/up/down/up will be lost)
@@ -10001,6 +11341,11 @@ void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
     // FIXME: Could specialize chars<>keys trickling rules for control keys (those not typically associated to characters)
     const bool trickle_interleaved_nonchar_keys_and_text = (trickle_fast_inputs && g.WantTextInputNextFrame == 1);
 
+#ifdef IMGUI_ENABLE_INPUT_THREAD_QUEUE
+    // Move events posted from other threads into our queue
+    UpdateInputEventThreadQueue();
+#endif
+
     bool mouse_moved = false, mouse_wheeled = false, key_changed = false, key_changed_nonchar = false, text_inputted = false;
     int  mouse_button_changed = 0x00;
     ImBitArray<ImGuiKey_NamedKey_COUNT> key_changed_mask;
@@ -10009,6 +11354,8 @@ void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
     for (; event_n < g.InputEventsQueue.Size; event_n++)
     {
         ImGuiInputEvent* e = &g.InputEventsQueue[event_n];
+        if (e->TrailOnly)
+            continue;
         if (e->Type == ImGuiInputEventType_MousePos)
         {
             if (g.IO.WantSetMousePos)
@@ -10094,10 +11441,15 @@ void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
         }
     }
 
+    // Raw events coalesced into an event which wasn't processed are kept with it
+    while (event_n > 0 && event_n < g.InputEventsQueue.Size && g.InputEventsQueue[event_n - 1].TrailOnly)
+        event_n--;
+
     // Record trail (for domain-specific applications wanting to access a precise trail)
     //if (event_n != 0) IMGUI_DEBUG_LOG_IO("Processed: %d / Remaining: %d\n", event_n, g.InputEventsQueue.Size - event_n);
     for (int n = 0; n < event_n; n++)
-        g.InputEventsTrail.push_back(g.InputEventsQueue[n]);
+        if (!g.InputEventsQueue[n].NotInTrail)
+            g.InputEventsTrail.push_back(g.InputEventsQueue[n]);
 
     // [DEBUG]
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
@@ -10421,6 +11773,8 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     IM_ASSERT((g.FrameCount == 0 || g.FrameCountEnded == g.FrameCount)  && "Forgot to call Render() or EndFrame() at the end of the previous frame?");
     IM_ASSERT(g.IO.DisplaySize.x >= 0.0f && g.IO.DisplaySize.y >= 0.0f  && "Invalid DisplaySize value!");
     IM_ASSERT(g.IO.Fonts->IsBuilt()                                     && "Font Atlas not built! Make sure you called ImGui_ImplXXXX_NewFrame() function for renderer backend, which should call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8()");
+    IM_ASSERT((!(g.IO.Fonts->Flags & ImFontAtlasFlags_SDF) || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSdfFonts)) && "Font Atlas built with ImFontAtlasFlags_SDF but renderer backend doesn't support it!");
+    IM_ASSERT((g.IO.Fonts->GetTexPageCount() == 1 || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexPages)) && "Font Atlas has multiple texture pages but renderer backend doesn't support it! Increase ImFontAtlas::TexPageSize or reduce glyph ranges.");
     IM_ASSERT(g.Style.CurveTessellationTol > 0.0f                       && "Invalid style setting!");
     IM_ASSERT(g.Style.CircleTessellationMaxError > 0.0f                 && "Invalid style setting!");
     IM_ASSERT(g.Style.Alpha >= 0.0f && g.Style.Alpha <= 1.0f            && "Invalid style setting!"); // Allows us to avoid a few clamps in color computations
@@ -15285,6 +16639,8 @@ void ImGui::UpdateDebugToolFlashStyleColor()
     g.Style.Colors[g.DebugFlashStyleColorIdx].w = 1.0f;
     if ((g.DebugFlashStyleColorTime -= g.IO.DeltaTime) <= 0.0f)
         DebugFlashStyleColorStop();
+    else
+        RequestRefresh();
 }
 
 static const char* FormatTextureIDForDebugDisplay(char* buf, int buf_size, ImTextureID tex_id)
@@ -15320,14 +16676,31 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
         DebugNodeFont(font);
         PopID();
     }
-    if (TreeNode("Font Atlas", "Font Atlas (%dx%d pixels)", atlas->TexWidth, atlas->TexHeight))
+    const int tex_page_count = atlas->GetTexPageCount();
+    if (TreeNode("Font Atlas", "Font Atlas (%dx%d pixels, %d page%s)", atlas->TexWidth, atlas->TexHeight, tex_page_count, tex_page_count > 1 ? "s" : ""))
     {
         ImGuiContext& g = *GImGui;
         ImGuiMetricsConfig* cfg = &g.DebugMetricsConfig;
         Checkbox("Tint with Text Color", &cfg->ShowAtlasTintedWithTextColor); // Using text color ensure visibility of core atlas data, but will alter custom colored icons
         ImVec4 tint_col = cfg->ShowAtlasTintedWithTextColor ? GetStyleColorVec4(ImGuiCol_Text) : ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
         ImVec4 border_col = GetStyleColorVec4(ImGuiCol_Border);
-        Image(atlas->TexID, ImVec2((float)atlas->TexWidth, (float)atlas->TexHeight), ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), tint_col, border_col);
+
+        // Texture memory for each format. What is actually uploaded depends on the backend: ImFontAtlasFlags_TexFormatXXX are requests.
+        const int tex_format_request = (atlas->Flags & ImFontAtlasFlags_TexFormatBC4) ? 2 : (atlas->Flags & ImFontAtlasFlags_TexFormatAlpha8) ? 1 : 0;
+        const size_t tex_size_rgba32 = (size_t)atlas->TexWidth * atlas->TexHeight * tex_page_count * 4;
+        const size_t tex_size_alpha8 = (size_t)atlas->TexWidth * atlas->TexHeight * tex_page_count;
+        const size_t tex_size_bc4 = (size_t)((atlas->TexWidth + 3) / 4) * ((atlas->TexHeight + 3) / 4) * 8 * tex_page_count;
+        Text("Texture memory%s:", atlas->TexPixelsUseColors ? " (atlas uses colors: RGBA32 required)" : "");
+        BulletText("RGBA32: %6d KB (100%%)%s%s", (int)(tex_size_rgba32 / 1024), tex_format_request == 0 ? " <- requested" : "", atlas->TexPixelsRGBA32 ? ", CPU copy allocated" : "");
+        BulletText("Alpha8: %6d KB (%3d%%)%s%s", (int)(tex_size_alpha8 / 1024), (int)(tex_size_alpha8 * 100 / ImMax(tex_size_rgba32, (size_t)1)), tex_format_request == 1 ? " <- requested" : "", atlas->TexPixelsAlpha8 ? ", CPU copy allocated" : "");
+        BulletText("BC4:    %6d KB (%3d%%)%s%s", (int)(tex_size_bc4 / 1024), (int)(tex_size_bc4 * 100 / ImMax(tex_size_rgba32, (size_t)1)), tex_format_request == 2 ? " <- requested" : "", atlas->TexPixelsBC4 ? ", CPU copy allocated" : "");
+
+        for (int tex_page = 0; tex_page < tex_page_count; tex_page++)
+        {
+            if (tex_page_count > 1)
+                Text("Page %d:", tex_page);
+            Image(atlas->GetTexPageID(tex_page), ImVec2((float)atlas->TexWidth, (float)atlas->TexHeight), ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), tint_col, border_col);
+        }
         TreePop();
     }
 }
@@ -15697,12 +17070,106 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
-    // Settings
+    // Profiler
+    if (TreeNode("Profiler"))
+    {
+#ifdef IMGUI_ENABLE_PROFILER
+        ImGuiProfiler* profiler = &g.Profiler;
+        Checkbox("Pause", &profiler->Paused);
+        SameLine();
+        if (SmallButton("Export Chrome trace"))
+        {
+            ImGuiTextBuffer buf;
+            DebugProfilerExportChromeTrace(&buf);
+            if (ImFileHandle f = ImFileOpen("imgui_trace.json", "wt"))
+            {
+                ImFileWrite(buf.c_str(), sizeof(char), (ImU64)buf.size(), f);
+                ImFileClose(f);
+            }
+        }
+        SameLine();
+        MetricsHelpMarker("Export last frames to imgui_trace.json, to open with chrome://tracing or https://ui.perfetto.dev.\n\nTimes are averaged over recorded frames. Inclusive time includes nested scopes (e.g. child windows, tables), exclusive time doesn't.\nNote that windows submitted while the implicit \"Debug##Default\" window is current are nested into it.");
+
+        // Aggregate recorded frames, skipping frame being recorded
+        struct ProfilerStat { const char* Name; ImGuiID OwnerID; int Count; double InclusiveNs; double ExclusiveNs; };
+        ImVector<ProfilerStat> stats;
+        ImGuiStorage stats_map;
+        ImVector<double> events_exclusive;
+        ImVector<int> events_by_depth;
+        int frames_count = 0;
+        for (int frame_idx = 0; frame_idx < IMGUI_PROFILER_FRAMES_COUNT; frame_idx++)
+        {
+            const ImGuiProfilerFrame* frame = &profiler->Frames[frame_idx];
+            if (frame->FrameCount == 0 || (frame_idx == profiler->FrameIdx && profiler->Recording))
+                continue;
+            frames_count++;
+            events_exclusive.resize(frame->Events.Size);
+            for (int event_n = 0; event_n < frame->Events.Size; event_n++)
+            {
+                const ImGuiProfilerEvent* event = &frame->Events[event_n];
+                const double duration = (double)(event->TimeEnd - event->TimeBegin);
+                events_exclusive[event_n] = duration;
+                events_by_depth.resize(ImMax(events_by_depth.Size, event->Depth + 1));
+                events_by_depth[event->Depth] = event_n;
+                if (event->Depth > 0)
+                    events_exclusive[events_by_depth[event->Depth - 1]] -= duration;
+            }
+            for (int event_n = 0; event_n < frame->Events.Size; event_n++)
+            {
+                const ImGuiProfilerEvent* event = &frame->Events[event_n];
+                int* p_stat_idx = stats_map.GetIntRef(ImHashData(&event->Name, sizeof(event->Name), event->OwnerID), -1);
+                if (*p_stat_idx == -1)
+                {
+                    *p_stat_idx = stats.Size;
+                    ProfilerStat stat = { event->Name, event->OwnerID, 0, 0.0, 0.0 };
+                    stats.push_back(stat);
+                }
+                ProfilerStat* stat = &stats[*p_stat_idx];
+                stat->Count++;
+                stat->InclusiveNs += (double)(event->TimeEnd - event->TimeBegin);
+                stat->ExclusiveNs += events_exclusive[event_n];
+            }
+        }
+        struct Func { static int IMGUI_CDECL StatComparerByInclusiveTime(const void* lhs, const void* rhs) { const double d = ((const ProfilerStat*)rhs)->InclusiveNs - ((const ProfilerStat*)lhs)->InclusiveNs; return (d > 0.0) ? +1 : (d < 0.0) ? -1 : 0; } };
+        if (stats.Size > 1)
+            ImQsort(stats.Data, (size_t)stats.Size, sizeof(ProfilerStat), Func::StatComparerByInclusiveTime);
+
+        Text("%d recorded frames, %d scopes", frames_count, stats.Size);
+        if (frames_count > 0 && BeginTable("##profiler", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 16)))
+        {
+            TableSetupScrollFreeze(0, 1);
+            TableSetupColumn("Scope");
+            TableSetupColumn("Owner");
+            TableSetupColumn("Calls/frame");
+            TableSetupColumn("Inclusive ms");
+            TableSetupColumn("Exclusive ms");
+            TableHeadersRow();
+            for (const ProfilerStat& stat : stats)
+            {
+                char owner_name[128];
+                DebugProfilerGetOwnerName(stat.OwnerID, owner_name, IM_ARRAYSIZE(owner_name));
+                TableNextRow();
+                TableNextColumn(); TextUnformatted(stat.Name);
+                TableNextColumn(); TextUnformatted(owner_name);
+                TableNextColumn(); Text("%.1f", (double)stat.Count / frames_count);
+                TableNextColumn(); Text("%.3f", stat.InclusiveNs / frames_count / 1000000.0);
+                TableNextColumn(); Text("%.3f", stat.ExclusiveNs / frames_count / 1000000.0);
+            }
+            EndTable();
+        }
+#else
+        TextDisabled("#define IMGUI_ENABLE_PROFILER to record NewFrame, Begin/End, tables layout and Render scopes.");
+#endif
+        TreePop();
+    }
+
     if (TreeNode("Memory allocations"))
     {
         ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
         Text("%d current allocations", info->TotalAllocCount - info->TotalFreeCount);
         if (SmallButton("GC now")) { g.GcCompactAll = true; }
+        Text("Frame arena: %d bytes used (prev frame %d, high-water mark %d), %d bytes reserved in %d block(s)", g.FrameArena.UsedBytes, g.FrameArena.UsedBytesPrevFrame, g.FrameArena.UsedBytesHighWaterMark, g.FrameArena.ReservedBytes, g.FrameArena.Blocks.Size);
+        Text("Frame arena: %d large allocation(s) forwarded to MemAlloc() (prev frame %d)", g.FrameArena.HeapAllocs.Size, g.FrameArena.HeapAllocsPrevFrame);
         Text("Recent frames with allocations:");
         int buf_size = IM_ARRAYSIZE(info->LastEntriesBuf);
         for (int n = buf_size - 1; n >= 0; n--)
@@ -15715,6 +17182,62 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                 Text("<- %d frames ago", g.FrameCount - entry->FrameCount);
             }
         }
+#ifdef IMGUI_DEBUG_ALLOC_CALLSITES
+        if (TreeNode("Call sites", "Call sites (%d, %d overflowed allocations)", info->CallSitesCount, info->CallSitesOverflowCount))
+        {
+            if (SmallButton("Copy report to clipboard"))
+            {
+                ImGuiTextBuffer buf;
+                DebugAllocCallSitesReport(info, &buf);
+                SetClipboardText(buf.c_str());
+            }
+            SameLine();
+            if (SmallButton("Reset"))
+            {
+                memset(info->CallSites, 0, sizeof(info->CallSites));
+                info->CallSitesCount = info->CallSitesOverflowCount = 0;
+            }
+            SameLine();
+            MetricsHelpMarker("Sorted by total bytes. Highlighted call-sites allocated during the previous frame.\nAll ImVector<> allocations share the same call-site in imgui.h: use 'Last Window' to find the culprit.");
+
+            // Sort into a stack buffer, so this window doesn't allocate.
+            ImGuiDebugAllocCallSite* sites[IM_ARRAYSIZE(info->CallSites)];
+            int sites_count = 0;
+            for (ImGuiDebugAllocCallSite& site : info->CallSites)
+                if (site.File != NULL)
+                    sites[sites_count++] = &site;
+            ImQsort(sites, (size_t)sites_count, sizeof(ImGuiDebugAllocCallSite*), DebugAllocCallSiteComparerByTotalBytes);
+            if (BeginTable("##callsites", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY, ImVec2(0.0f, GetTextLineHeightWithSpacing() * 16)))
+            {
+                TableSetupScrollFreeze(0, 1);
+                TableSetupColumn("File:Line");
+                TableSetupColumn("Allocs");
+                TableSetupColumn("Bytes");
+                TableSetupColumn("Frames");
+                TableSetupColumn("Last Frame");
+                TableSetupColumn("Last Window");
+                TableHeadersRow();
+                for (int n = 0; n < sites_count; n++)
+                {
+                    ImGuiDebugAllocCallSite* site = sites[n];
+                    ImGuiWindow* window = site->LastWindowID ? FindWindowByID(site->LastWindowID) : NULL;
+                    TableNextRow();
+                    if (site->LastFrame >= g.FrameCount - 1)
+                        TableSetBgColor(ImGuiTableBgTarget_RowBg1, GetColorU32(ImGuiCol_PlotHistogram, 0.25f));
+                    TableNextColumn(); Text("%s:%d", DebugAllocCallSiteGetFilename(site->File), site->Line);
+                    TableNextColumn(); Text("%d", site->TotalAllocCount);
+                    TableNextColumn(); Text("%llu", (unsigned long long)site->TotalAllocBytes);
+                    TableNextColumn(); Text("%d", site->FramesWithAllocsCount);
+                    TableNextColumn(); Text("%d (%d, %d bytes)", site->LastFrame, site->LastFrameAllocCount, site->LastFrameAllocBytes);
+                    TableNextColumn(); TextUnformatted(window ? window->Name : "");
+                }
+                EndTable();
+            }
+            TreePop();
+        }
+#else
+        TextDisabled("Call sites: #define IMGUI_DEBUG_ALLOC_CALLSITES to record them.");
+#endif
         TreePop();
     }
 
@@ -16143,11 +17666,20 @@ void ImGui::DebugNodeFont(ImFont* font)
     Text("Ellipsis character: '%s' (U+%04X)", ImTextCharToUtf8(c_str, font->EllipsisChar), font->EllipsisChar);
     const int surface_sqrt = (int)ImSqrt((float)font->MetricsTotalSurface);
     Text("Texture Area: about %d px ~%dx%d px", font->MetricsTotalSurface, surface_sqrt, surface_sqrt);
+    const int index_bytes = font->IndexAdvanceX.size_in_bytes() + font->IndexLookup.size_in_bytes() + font->IndexPageMap.size_in_bytes() + font->IndexPagesAdvanceX.size_in_bytes() + font->IndexPagesLookup.size_in_bytes();
+    Text("Glyph index: %d bytes (U+0000..U+%04X direct, %d extra pages)", index_bytes, ImMax(font->IndexLookup.Size - 1, 0), ImMax(font->IndexPagesLookup.Size / 256 - 1, 0));
+    SameLine(); MetricsHelpMarker("Code-points are indexed in pages of 256. The first used pages are directly indexable, other used pages are allocated separately. Unused pages share a single empty page.");
     for (int config_i = 0; config_i < font->ConfigDataCount; config_i++)
         if (font->ConfigData)
             if (const ImFontConfig* cfg = &font->ConfigData[config_i])
+            {
                 BulletText("Input %d: \'%s\', Oversample: (%d,%d), PixelSnapH: %d, Offset: (%.1f,%.1f)",
                     config_i, cfg->Name, cfg->OversampleH, cfg->OversampleV, cfg->PixelSnapH, cfg->GlyphOffset.x, cfg->GlyphOffset.y);
+                if (const ImFontBlob* blob = cfg->FontBlob)
+                    BulletText("Input %d data: %d KB, %s, shared by %d input(s)", config_i, (int)(blob->DataSize / 1024), blob->IsMapped ? "memory-mapped" : "heap", blob->RefCount);
+                else if (cfg->FontData)
+                    BulletText("Input %d data: %d KB, heap, not shared", config_i, cfg->FontDataSize / 1024);
+            }
 
     // Display all glyphs of the fonts in separate pages of 256 characters
     if (TreeNode("Glyphs", "Glyphs (%d)", font->Glyphs.Size))
@@ -16211,6 +17743,7 @@ void ImGui::DebugNodeFontGlyph(ImFont*, const ImFontGlyph* glyph)
     Text("AdvanceX: %.1f", glyph->AdvanceX);
     Text("Pos: (%.2f,%.2f)->(%.2f,%.2f)", glyph->X0, glyph->Y0, glyph->X1, glyph->Y1);
     Text("UV: (%.3f,%.3f)->(%.3f,%.3f)", glyph->U0, glyph->V0, glyph->U1, glyph->V1);
+    Text("TexPage: %d", glyph->TexPage);
 }
 
 // [DEBUG] Display contents of ImGuiStorage
@@ -16414,21 +17947,27 @@ void ImGui::DebugLog(const char* fmt, ...)
 void ImGui::DebugLogV(const char* fmt, va_list args)
 {
     ImGuiContext& g = *GImGui;
-    const int old_size = g.DebugLogBuf.size();
+    ImGuiTextBuffer& buf = g.DebugLogLineBuf;
+    buf.Buf.resize(0);
     if (g.ContextName[0] != 0)
-        g.DebugLogBuf.appendf("[%s] [%05d] ", g.ContextName, g.FrameCount);
+        buf.appendf("[%s] [%05d] ", g.ContextName, g.FrameCount);
     else
-        g.DebugLogBuf.appendf("[%05d] ", g.FrameCount);
-    g.DebugLogBuf.appendfv(fmt, args);
-    g.DebugLogIndex.append(g.DebugLogBuf.c_str(), old_size, g.DebugLogBuf.size());
+        buf.appendf("[%05d] ", g.FrameCount);
+    buf.appendfv(fmt, args);
+
+    // Store lines in ring buffer, evicting oldest lines once capacity is reached. Text without a trailing '\n' is continued by next log.
+    if (!g.DebugLogRing.IsCreated())
+        g.DebugLogRing.Create(1024 * 1024, 16 * 1024);
+    g.DebugLogRing.append(buf.begin(), buf.end(), (ImU32)g.DebugLogCurrentCategory);
+
     if (g.DebugLogFlags & ImGuiDebugLogFlags_OutputToTTY)
-        IMGUI_DEBUG_PRINTF("%s", g.DebugLogBuf.begin() + old_size);
+        IMGUI_DEBUG_PRINTF("%s", buf.c_str());
 #ifdef IMGUI_ENABLE_TEST_ENGINE
     // IMGUI_TEST_ENGINE_LOG() adds a trailing \n automatically
-    const int new_size = g.DebugLogBuf.size();
-    const bool trailing_carriage_return = (g.DebugLogBuf[new_size - 1] == '\n');
+    const int new_size = buf.size();
+    const bool trailing_carriage_return = (buf[new_size - 1] == '\n');
     if (g.DebugLogFlags & ImGuiDebugLogFlags_OutputToTestEngine)
-        IMGUI_TEST_ENGINE_LOG("%.*s", new_size - old_size - (trailing_carriage_return ? 1 : 0), g.DebugLogBuf.begin() + old_size);
+        IMGUI_TEST_ENGINE_LOG("%.*s", new_size - (trailing_carriage_return ? 1 : 0), buf.begin());
 #endif
 }
 
@@ -16493,18 +18032,46 @@ void ImGui::ShowDebugLogWindow(bool* p_open)
     ShowDebugLogFlag("Selection", ImGuiDebugLogFlags_EventSelection);
     ShowDebugLogFlag("InputRouting", ImGuiDebugLogFlags_EventInputRouting);
 
+    ImGuiTextRingBuffer& ring = g.DebugLogRing;
     if (SmallButton("Clear"))
     {
-        g.DebugLogBuf.clear();
-        g.DebugLogIndex.clear();
+        ring.Clear();
         g.DebugLogSkippedErrors = 0;
     }
     SameLine();
     if (SmallButton("Copy"))
-        SetClipboardText(g.DebugLogBuf.c_str());
+    {
+        ImGuiTextBuffer copy_buf;
+        for (int line_no = 0; line_no < ring.size(); line_no++)
+            copy_buf.append(ring.get_line_begin(line_no), ring.get_line_end(line_no) + 1); // Include trailing \n
+        SetClipboardText(copy_buf.c_str());
+    }
+    SameLine();
+    if (SmallButton("Filter.."))
+        OpenPopup("Filter");
+    if (BeginPopup("Filter"))
+    {
+        CheckboxFlags("All", &g.DebugLogViewFilter, ImGuiDebugLogFlags_EventMask_);
+        Separator();
+        CheckboxFlags("Errors", &g.DebugLogViewFilter, ImGuiDebugLogFlags_EventError);
+        CheckboxFlags("ActiveId", &g.DebugLogViewFilter, ImGuiDebugLogFlags_EventActiveId);
+        CheckboxFlags("Clipper", &g.DebugLogViewFilter, ImGuiDebugLogFlags_EventClipper);
+        CheckboxFlags("Focus", &g.DebugLogViewFilter, ImGuiDebugLogFlags_EventFocus);
+        CheckboxFlags("IO", &g.DebugLogViewFilter, ImGuiDebugLogFlags_EventIO);
+        CheckboxFlags("Nav", &g.DebugLogViewFilter, ImGuiDebugLogFlags_EventNav);
+        CheckboxFlags("Popup", &g.DebugLogViewFilter, ImGuiDebugLogFlags_EventPopup);
+        CheckboxFlags("Selection", &g.DebugLogViewFilter, ImGuiDebugLogFlags_EventSelection);
+        CheckboxFlags("InputRouting", &g.DebugLogViewFilter, ImGuiDebugLogFlags_EventInputRouting);
+        EndPopup();
+    }
     SameLine();
     if (SmallButton("Configure Outputs.."))
         OpenPopup("Outputs");
+    if (ring.EvictedCount > 0)
+    {
+        SameLine();
+        TextDisabled("(%d old lines discarded)", ring.EvictedCount);
+    }
     if (BeginPopup("Outputs"))
     {
         CheckboxFlags("OutputToTTY", &g.DebugLogFlags, ImGuiDebugLogFlags_OutputToTTY);
@@ -16523,11 +18090,28 @@ void ImGui::ShowDebugLogWindow(bool* p_open)
     const ImGuiDebugLogFlags backup_log_flags = g.DebugLogFlags;
     g.DebugLogFlags &= ~ImGuiDebugLogFlags_EventClipper;
 
+    // Filter by category: gather indices of visible lines (lines are not copied)
+    const bool use_view_filter = (g.DebugLogViewFilter & ImGuiDebugLogFlags_EventMask_) != ImGuiDebugLogFlags_EventMask_;
+    ImFrameVector<int> filtered_lines(&g.FrameArena);
+    if (use_view_filter)
+    {
+        filtered_lines.reserve(ring.size());
+        for (int line_no = 0; line_no < ring.size(); line_no++)
+        {
+            const ImU32 line_category = ring.get_line(line_no).Flags;
+            if (line_category == 0 || (line_category & g.DebugLogViewFilter))
+                filtered_lines.push_back(line_no);
+        }
+    }
+
     ImGuiListClipper clipper;
-    clipper.Begin(g.DebugLogIndex.size());
+    clipper.Begin(use_view_filter ? filtered_lines.Size : ring.size());
     while (clipper.Step())
-        for (int line_no = clipper.DisplayStart; line_no < clipper.DisplayEnd; line_no++)
-            DebugTextUnformattedWithLocateItem(g.DebugLogIndex.get_line_begin(g.DebugLogBuf.c_str(), line_no), g.DebugLogIndex.get_line_end(g.DebugLogBuf.c_str(), line_no));
+        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+        {
+            const int line_no = use_view_filter ? filtered_lines[n] : n;
+            DebugTextUnformattedWithLocateItem(ring.get_line_begin(line_no), ring.get_line_end(line_no));
+        }
     g.DebugLogFlags = backup_log_flags;
     if (GetScrollY() >= GetScrollMaxY())
         SetScrollHereY(1.0f);
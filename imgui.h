@@ -45,7 +45,7 @@ Index of this file:
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
-// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
+// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage, ImGuiSelectionRangeStorage)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -168,6 +168,7 @@ struct ImDrawListSplitter;          // Helper to split a draw list into differen
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontBlob;                  // Opaque reference-counted TTF/OTF data shared between ImFontConfig entries and atlases (see imgui_internal.h)
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
@@ -176,6 +177,7 @@ struct ImColor;                     // Helper functions to create a color that c
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui (also see: ImGuiPlatformIO)
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
+struct ImGuiHashedStr;              // String literal with its hash computed at compile time, see IM_HASHED_STR()
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
@@ -185,6 +187,7 @@ struct ImGuiPlatformIO;             // Interface between platform/renderer backe
 struct ImGuiPlatformImeData;        // Platform IME data for io.PlatformSetImeDataFn() function.
 struct ImGuiSelectionBasicStorage;  // Optional helper to store multi-selection state + apply multi-selection requests.
 struct ImGuiSelectionExternalStorage;//Optional helper to apply multi-selection requests to existing randomly accessible storage.
+struct ImGuiSelectionRangeStorage;  // Optional helper to store multi-selection state of index-addressable items as a set of ranges.
 struct ImGuiSelectionRequest;       // A selection request (stored in ImGuiMultiSelectIO)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage (container sorted by key)
@@ -518,15 +521,18 @@ namespace ImGui
     // - You can also use the "Label##foobar" syntax within widget label to distinguish them from each others.
     // - In this header file we use the "label"/"name" terminology to denote a string that will be displayed + used as an ID,
     //   whereas "str_id" denote a string that is only used as an ID and not normally displayed.
+    // - String literals may be hashed at compile time: PushID(IM_HASHED_STR("Settings")), Button(IM_HASHED_LABEL("Save")). See IM_HASHED_STR().
     IMGUI_API void          PushID(const char* str_id);                                     // push string into the ID stack (will hash string).
     IMGUI_API void          PushID(const char* str_id_begin, const char* str_id_end);       // push string into the ID stack (will hash string).
     IMGUI_API void          PushID(const void* ptr_id);                                     // push pointer into the ID stack (will hash pointer).
     IMGUI_API void          PushID(int int_id);                                             // push integer into the ID stack (will hash integer).
+    IMGUI_API void          PushID(const ImGuiHashedStr& str_id);                           // push string literal hashed at compile time into the ID stack. Same ID as PushID(const char*).
     IMGUI_API void          PopID();                                                        // pop from the ID stack.
     IMGUI_API ImGuiID       GetID(const char* str_id);                                      // calculate unique ID (hash of whole ID stack + given parameter). e.g. if you want to query into ImGuiStorage yourself
     IMGUI_API ImGuiID       GetID(const char* str_id_begin, const char* str_id_end);
     IMGUI_API ImGuiID       GetID(const void* ptr_id);
     IMGUI_API ImGuiID       GetID(int int_id);
+    IMGUI_API ImGuiID       GetID(const ImGuiHashedStr& str_id);
 
     // Widgets: Text
     IMGUI_API void          TextUnformatted(const char* text, const char* text_end = NULL); // raw text without formatting. Roughly equivalent to Text("%s", text) but: A) doesn't require null terminated string if 'text_end' is specified, B) it's faster, no memory copy is done, no buffer size limits, recommended for long chunks of text.
@@ -672,6 +678,7 @@ namespace ImGui
     IMGUI_API bool          CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFlags flags = 0); // when 'p_visible != NULL': if '*p_visible==true' display an additional small close button on upper right of the header which will set the bool to false when clicked, if '*p_visible==false' don't display the header.
     IMGUI_API void          SetNextItemOpen(bool is_open, ImGuiCond cond = 0);                  // set next TreeNode/CollapsingHeader open state.
     IMGUI_API void          SetNextItemStorageID(ImGuiID storage_id);                           // set id to use for open/close storage (default to same as item id).
+    IMGUI_API void          SetNextItemHashedLabel(const ImGuiHashedStr& label);                // use precomputed hash when next item hashes this exact label pointer. Prefer using IM_HASHED_LABEL().
 
     // Widgets: Selectables
     // - A selectable highlights when hovered, and can display another color when selected.
@@ -810,12 +817,15 @@ namespace ImGui
     //        - TableNextRow() -> TableNextColumn()      -> Text("Hello 0") -> TableNextColumn()      -> Text("Hello 1")  // OK
     //        -                   TableNextColumn()      -> Text("Hello 0") -> TableNextColumn()      -> Text("Hello 1")  // OK: TableNextColumn() automatically gets to next row!
     //        - TableNextRow()                           -> Text("Hello 0")                                               // Not OK! Missing TableSetColumnIndex() or TableNextColumn()! Text will not appear!
+    //    - For very wide tables using horizontal scrolling, you may iterate only visible columns of a row:
+    //        - TableNextRow() -> while (TableNextVisibleColumn()) { int column_n = TableGetColumnIndex(); ... }
     // - 5. Call EndTable()
     IMGUI_API bool          BeginTable(const char* str_id, int columns, ImGuiTableFlags flags = 0, const ImVec2& outer_size = ImVec2(0.0f, 0.0f), float inner_width = 0.0f);
     IMGUI_API void          EndTable();                                         // only call EndTable() if BeginTable() returns true!
     IMGUI_API void          TableNextRow(ImGuiTableRowFlags row_flags = 0, float min_row_height = 0.0f); // append into the first cell of a new row.
     IMGUI_API bool          TableNextColumn();                                  // append into the next column (or first column of next row if currently in last column). Return true when column is visible.
     IMGUI_API bool          TableSetColumnIndex(int column_n);                  // append into the specified column. Return true when column is visible.
+    IMGUI_API bool          TableNextVisibleColumn();                           // append into the next column of current row which is visible (or auto-fitting), skipping other columns entirely. Return false when there are no more such columns in current row. Skipped columns don't contribute to row height.
 
     // Tables: Headers & Columns declaration
     // - Use TableSetupColumn() to specify label, resizing policy, default width/weight, id, various other flags etc.
@@ -953,6 +963,7 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API void          RequestRefresh(float delay = 0.0f);                                 // request output to be refreshed within 'delay' seconds even without new inputs (e.g. your own animations). Lowers io.NextRefreshDelay for this frame.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
@@ -1059,6 +1070,7 @@ namespace ImGui
     IMGUI_API void          GetAllocatorFunctions(ImGuiMemAllocFunc* p_alloc_func, ImGuiMemFreeFunc* p_free_func, void** p_user_data);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
+    IMGUI_API void*         MemAllocEx(size_t size, const char* file, int line);    // Same as MemAlloc(), recording call-site when IMGUI_DEBUG_ALLOC_CALLSITES is defined.
 
 } // namespace ImGui
 
@@ -1608,6 +1620,8 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasSdfFonts   = 1 << 4,   // Backend Renderer supports font atlases built with ImFontAtlasFlags_SDF (decodes the distance field of the font texture in its fragment shader).
+    ImGuiBackendFlags_RendererHasTexPages   = 1 << 5,   // Backend Renderer supports font atlases with multiple texture pages (see ImFontAtlas::TexPageSize): it uploads every page and calls ImFontAtlas::SetTexPageID().
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2036,10 +2050,14 @@ struct ImGuiTableColumnSortSpecs
 struct ImNewWrapper {};
 inline void* operator new(size_t, ImNewWrapper, void* ptr) { return ptr; }
 inline void  operator delete(void*, ImNewWrapper, void*)   {} // This is only required so we can use the symmetrical new()
+#ifdef IMGUI_DEBUG_ALLOC_CALLSITES
+#define IM_ALLOC(_SIZE)                     ImGui::MemAllocEx(_SIZE, __FILE__, __LINE__)
+#else
 #define IM_ALLOC(_SIZE)                     ImGui::MemAlloc(_SIZE)
+#endif
 #define IM_FREE(_PTR)                       ImGui::MemFree(_PTR)
 #define IM_PLACEMENT_NEW(_PTR)              new(ImNewWrapper(), _PTR)
-#define IM_NEW(_TYPE)                       new(ImNewWrapper(), ImGui::MemAlloc(sizeof(_TYPE))) _TYPE
+#define IM_NEW(_TYPE)                       new(ImNewWrapper(), IM_ALLOC(sizeof(_TYPE))) _TYPE
 template<typename T> void IM_DELETE(T* p)   { if (p) { p->~T(); ImGui::MemFree(p); } }
 
 //-----------------------------------------------------------------------------
@@ -2371,6 +2389,7 @@ struct ImGuiIO
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
+    float       NextRefreshDelay;                   // Set by EndFrame(): delay in seconds after which output may change without new inputs. 0.0f: animating, render next frame ASAP. FLT_MAX: idle, may wait for next input. Main loop may wait for events with this timeout to skip idle frames (see examples).
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     //------------------------------------------------------------------
@@ -2527,6 +2546,34 @@ struct ImGuiPayload
 #define IM_UNICODE_CODEPOINT_MAX     0xFFFF     // Maximum Unicode code point supported by this build.
 #endif
 
+// Helper: Hash string literals at compile time, skipping runtime label hashing (e.g. in hot loops).
+// - IM_HASHED_STR("Settings") creates a ImGuiHashedStr, for PushID()/GetID(): PushID(IM_HASHED_STR("Settings")) == PushID("Settings").
+// - IM_HASHED_LABEL("Save") evaluates to "Save" after calling SetNextItemHashedLabel(): Button(IM_HASHED_LABEL("Save")) == Button("Save").
+// - The hash stored is the one of the string starting from its last "###" (if any), with a zero seed. Since our CRC32 hash is linear,
+//   combining it with the current ID stack seed at runtime only requires advancing the seed over the string length, which is
+//   8 bytes per instruction when SSE 4.2 is enabled, instead of hashing every character.
+// - Resulting IDs are the same as runtime hashing, and ImHashStrConstexpr("xxx", seed) == ImHashStr("xxx", 0, seed).
+// - Only use with string literals. Constexpr evaluation is recursive: very long strings may exceed compiler limits (e.g. -fconstexpr-depth).
+struct ImGuiHashedStr
+{
+    const char*     Str;        // String literal
+    ImU32           Crc;        // CRC32 of hashed part of Str, with a zero seed and without final inversion
+    ImU32           Len;        // Length of hashed part of Str (from its last "###", or whole string)
+};
+#ifdef IMGUI_USE_LEGACY_CRC32_ADLER
+#define IM_CRC32_POLY       0xEDB88320u     // Must match GCrc32LookupTable[] in imgui.cpp
+#else
+#define IM_CRC32_POLY       0x82F63B78u     // CRC32c, as used by SSE 4.2 instructions
+#endif
+constexpr ImU32         ImCrc32ConstexprByte(ImU32 crc, int bit = 0)                { return bit == 8 ? crc : ImCrc32ConstexprByte((crc >> 1) ^ ((crc & 1) ? IM_CRC32_POLY : 0), bit + 1); }
+constexpr ImU32         ImCrc32ConstexprStr(const char* s, ImU32 crc)               { return *s ? ImCrc32ConstexprStr(s + 1, (crc >> 8) ^ ImCrc32ConstexprByte((crc ^ (unsigned char)*s) & 0xFF)) : crc; }
+constexpr const char*   ImHashStrConstexprStart(const char* s, const char* start)   { return *s ? ImHashStrConstexprStart(s + 1, (s[0] == '#' && s[1] == '#' && s[2] == '#') ? s : start) : start; }
+constexpr ImU32         ImStrlenConstexpr(const char* s)                            { return *s ? 1 + ImStrlenConstexpr(s + 1) : 0; }
+constexpr ImGuiID       ImHashStrConstexpr(const char* s, ImGuiID seed = 0)         { return ~ImCrc32ConstexprStr(ImHashStrConstexprStart(s, s), ~seed); }
+template<ImU32 VALUE> struct ImConstU32 { enum : ImU32 { Value = VALUE }; };        // Force compile-time evaluation
+#define IM_HASHED_STR(_LITERAL)     ImGuiHashedStr{ _LITERAL, ImConstU32<ImCrc32ConstexprStr(ImHashStrConstexprStart(_LITERAL, _LITERAL), 0)>::Value, ImConstU32<ImStrlenConstexpr(ImHashStrConstexprStart(_LITERAL, _LITERAL))>::Value }
+#define IM_HASHED_LABEL(_LITERAL)   (ImGui::SetNextItemHashedLabel(IM_HASHED_STR(_LITERAL)), _LITERAL)
+
 // Helper: Execute a block of code at maximum once a frame. Convenient if you want to quickly create a UI within deep-nested code that runs multiple times every frame.
 // Usage: static ImGuiOnceUponAFrame oaf; if (oaf) ImGui::Text("This will be called only once per frame");
 struct ImGuiOnceUponAFrame
@@ -2769,7 +2816,7 @@ struct ImColor
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiSelectionRequestType, ImGuiSelectionRequest, ImGuiMultiSelectIO, ImGuiSelectionBasicStorage)
+// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiSelectionRequestType, ImGuiSelectionRequest, ImGuiMultiSelectIO, ImGuiSelectionBasicStorage, ImGuiSelectionRangeStorage)
 //-----------------------------------------------------------------------------
 
 // Multi-selection system
@@ -2916,6 +2963,34 @@ struct ImGuiSelectionExternalStorage
     IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests by using AdapterSetItemSelected() calls
 };
 
+// Optional helper to store multi-selection state of index-addressable items as a sorted set of inclusive ranges.
+// - Unlike ImGuiSelectionBasicStorage, items are stored by INDEX (there is no adapter): selection is lost/invalid if your items are reordered.
+// - Applying a SetRange request costs O(log N + N) where N is the number of stored ranges, regardless of the number of items in the request.
+//   This is well suited to very large lists or grids (e.g. 100k+ items) where BoxSelect or Shift+Click emits many SetRange requests.
+// - Iterate selection with 'void* it = NULL; int idx; while (selection.GetNextSelectedItem(&it, &idx)) { ... }'
+//   Or iterate ranges with 'void* it = NULL; int first, last; while (selection.GetNextSelectedRange(&it, &first, &last)) { ... }'
+// - Does not preserve selection order.
+struct ImGuiSelectionRangeStorage
+{
+    struct ImGuiSelectionRange { int Min, Max; };   // Inclusive
+
+    // Members
+    int             Size;           //          // Number of selected items, maintained by this helper.
+    ImVector<ImGuiSelectionRange> _Ranges; // [Internal] Sorted, non-overlapping, non-adjacent ranges. Prefer not accessing directly: iterate with GetNextSelectedRange().
+
+    // Methods
+    IMGUI_API ImGuiSelectionRangeStorage();
+    IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests coming from BeginMultiSelect() and EndMultiSelect() functions. It uses 'items_count' passed to BeginMultiSelect()
+    IMGUI_API bool  Contains(int idx) const;                    // Query if an item index is in selection. O(log N).
+    IMGUI_API void  Clear();                                    // Clear selection
+    IMGUI_API void  Swap(ImGuiSelectionRangeStorage& r);        // Swap two selections
+    IMGUI_API void  SetItemSelected(int idx, bool selected);    // Add/remove an item from selection (generally done by ApplyRequests() function)
+    IMGUI_API void  SetRangeSelected(int idx_first, int idx_last, bool selected); // Add/remove [idx_first..idx_last] (inclusive) from selection.
+    IMGUI_API bool  GetNextSelectedItem(void** opaque_it, int* out_idx);                       // Iterate selected indices in increasing order.
+    IMGUI_API bool  GetNextSelectedRange(void** opaque_it, int* out_first, int* out_last);     // Iterate selected ranges (inclusive) in increasing order.
+    int             GetRangesCount() const                      { return _Ranges.Size; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
@@ -2926,6 +3001,14 @@ struct ImGuiSelectionExternalStorage
 #define IM_DRAWLIST_TEX_LINES_WIDTH_MAX     (63)
 #endif
 
+// The number of cells and texels per cell of the baked alpha checkerboard pattern. Build atlas with ImFontAtlasFlags_NoBakedCheckerboard to disable baking.
+#ifndef IM_DRAWLIST_TEX_CHECKERBOARD_CELLS
+#define IM_DRAWLIST_TEX_CHECKERBOARD_CELLS      (4)     // Must be a multiple of 2
+#endif
+#ifndef IM_DRAWLIST_TEX_CHECKERBOARD_CELL_SIZE
+#define IM_DRAWLIST_TEX_CHECKERBOARD_CELL_SIZE  (16)    // Cells larger than this on screen get blurry edges with bilinear filtering
+#endif
+
 // ImDrawCallback: Draw callbacks for advanced uses [configurable type: override in imconfig.h]
 // NB: You most likely do NOT need to use draw callbacks just to create your own widget or customized UI rendering,
 // you can poke into the draw list for that! Draw callback may be useful for example to:
@@ -3256,6 +3339,7 @@ struct ImFontConfig
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
     ImFont*         DstFont;
+    ImFontBlob*     FontBlob;               // Shared data FontData points into, when loaded with AddFontFromFileTTF()/AddFontFromMemoryCompressedTTF()/AddFontFromMemoryCompressedBase85TTF(). Reference released by ClearInputData().
 
     IMGUI_API ImFontConfig();
 };
@@ -3266,7 +3350,8 @@ struct ImFontGlyph
 {
     unsigned int    Colored : 1;        // Flag to indicate glyph is colored and should generally ignore tinting (make it usable with no shift on little-endian as this is used in loops)
     unsigned int    Visible : 1;        // Flag to indicate glyph has no visible pixels (e.g. space). Allow early out when rendering.
-    unsigned int    Codepoint : 30;     // 0x0000..0x10FFFF
+    unsigned int    Codepoint : 22;     // 0x0000..0x10FFFF
+    unsigned int    TexPage : 8;        // Texture page of the font atlas containing this glyph (see ImFontAtlas::TexPageSize). Always 0 when the atlas has a single page.
     float           AdvanceX;           // Distance to next character (= data from font + ImFontConfig::GlyphExtraSpacing.x baked in)
     float           X0, Y0, X1, Y1;     // Glyph corners
     float           U0, V0, U1, V1;     // Texture coordinates
@@ -3311,6 +3396,10 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedCheckerboard = 1 << 3,  // Don't build alpha checkerboard pattern into the atlas (save a little texture memory). Color widgets use it to render alpha previews with a few textured quads, otherwise they will be rendered using one quad per checker cell.
+    ImFontAtlasFlags_SDF                = 1 << 4,   // Store glyphs as signed distance fields (see TexSdfSpread), so one atlas renders sharp text at any scale. Requires backend support (see ImGuiBackendFlags_RendererHasSdfFonts). Implies ImFontAtlasFlags_NoBakedLines. Alpha of custom rectangles is thresholded at 0.5 by the backend.
+    ImFontAtlasFlags_TexFormatAlpha8    = 1 << 5,   // Request backends to upload a single channel texture (e.g. R8, 1 byte per pixel, 4x less memory than RGBA32) sampled as (1,1,1,alpha). Backends without support upload RGBA32. Don't use if you write colors into the texture (see TexPixelsUseColors).
+    ImFontAtlasFlags_TexFormatBC4       = 1 << 6,   // Request backends to upload a BC4 block-compressed texture (see GetTexDataAsBC4(), 0.5 byte per pixel, 8x less memory than RGBA32). Lossy. Backends without support fall back to ImFontAtlasFlags_TexFormatAlpha8 behavior.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3328,6 +3417,9 @@ enum ImFontAtlasFlags_
 //   atlas is build (when calling GetTexData*** or Build()). We only copy the pointer, not the data.
 // - Important: By default, AddFontFromMemoryTTF() takes ownership of the data. Even though we are not writing to it, we will free the pointer on destruction.
 //   You can set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed,
+// - AddFontFromFileTTF() and AddFontFromMemoryCompressed***TTF() share their data: loading the same file or compressed data multiple times
+//   (e.g. at several sizes, merged, or in several atlases) keeps a single copy in memory. Files are memory-mapped when available
+//   (see IMGUI_DISABLE_FILE_MAPPING), are identified by their filename, and should not be modified while in use.
 // - Even though many functions are suffixed with "TTF", OTF data is supported just as well.
 // - This is an old API and it is currently awkward for those and various other reasons! We will address them in the future!
 struct ImFontAtlas
@@ -3338,7 +3430,7 @@ struct ImFontAtlas
     IMGUI_API ImFont*           AddFontDefault(const ImFontConfig* font_cfg = NULL);
     IMGUI_API ImFont*           AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);
     IMGUI_API ImFont*           AddFontFromMemoryTTF(void* font_data, int font_data_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // Note: Transfer ownership of 'ttf_data' to ImFontAtlas! Will be deleted after destruction of the atlas. Set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed.
-    IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_data_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp.
+    IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_data_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp (stb_compress or -lz4 format).
     IMGUI_API ImFont*           AddFontFromMemoryCompressedBase85TTF(const char* compressed_font_data_base85, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);              // 'compressed_font_data_base85' still owned by caller. Compress with binary_to_compressed_c.cpp with -base85 parameter.
     IMGUI_API void              ClearInputData();           // Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts.
     IMGUI_API void              ClearTexData();             // Clear output texture data (CPU side). Saves RAM once the texture has been copied to graphics memory.
@@ -3353,9 +3445,18 @@ struct ImFontAtlas
     IMGUI_API bool              Build();                    // Build pixels data. This is called automatically for you by the GetTexData*** functions.
     IMGUI_API void              GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 1 byte per-pixel
     IMGUI_API void              GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 4 bytes-per-pixel
+    IMGUI_API void              GetTexDataAsBC4(unsigned char** out_blocks, int* out_width, int* out_height, int* out_bytes_per_page = NULL);  // 8 bytes per 4x4 pixels block (BC4/RGTC1 unsigned, lossy). Only the alpha channel is encoded.
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't build texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Texture pages (when TexPageSize > 0 the atlas may be split into multiple textures of TexWidth x TexHeight)
+    // Pages are stored one after the other in the pixel data returned by GetTexData***(): page N starts at 'out_pixels + N * out_width * out_height * out_bytes_per_pixel' ('out_blocks + N * out_bytes_per_page' for GetTexDataAsBC4()).
+    // Page 0 always contains the custom rectangles (white pixel, mouse cursors, baked lines) and uses TexID.
+    int                         GetTexPageCount() const     { return TexPageIDs.Size + 1; }
+    ImTextureID                 GetTexPageID(int page) const{ IM_ASSERT(page >= 0 && page <= TexPageIDs.Size); return page == 0 ? TexID : TexPageIDs.Data[page - 1]; }
+    void                        SetTexPageID(int page, ImTextureID id) { IM_ASSERT(page >= 0 && page <= TexPageIDs.Size); if (page == 0) TexID = id; else TexPageIDs.Data[page - 1] = id; }
+    void                        SetLockedShared(bool locked){ IM_ASSERT(IsBuilt() || !locked); Locked = LockedShared = locked; } // Permanently lock a built atlas so it can be used by multiple contexts running concurrently on different threads (see IMGUI_THREAD_LOCAL_CONTEXT). Unlock after those contexts are done with it, before modifying or destroying it.
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -3401,23 +3502,29 @@ struct ImFontAtlas
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // FIXME: Should be called "TexPackPadding". Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0 (will also need to set AntiAliasedLinesUseTex = false).
+    int                         TexSdfSpread;       // = 4      // With ImFontAtlasFlags_SDF: distance in pixels encoded on each side of glyph edges (2..32). Larger values cost texture space but allow scaling further down and drawing thicker effects.
+    int                         TexPageSize;        // = 0      // If > 0: maximum texture width and height (power-of-two, >= 256). Glyphs which don't fit are packed into additional texture pages of the same size, see GetTexPageCount(). Requires backend support (see ImGuiBackendFlags_RendererHasTexPages).
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
+    bool                        LockedShared;       // Marked by SetLockedShared(): atlas is permanently locked and may be used concurrently by contexts running on different threads.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
     bool                        TexReady;           // Set when texture was built matching current font input
     bool                        TexPixelsUseColors; // Tell whether our texture data is known to use colors (rather than just alpha channel), in order to help backend select a format.
-    unsigned char*              TexPixelsAlpha8;    // 1 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight
-    unsigned int*               TexPixelsRGBA32;    // 4 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight * 4
+    unsigned char*              TexPixelsAlpha8;    // 1 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight * GetTexPageCount()
+    unsigned int*               TexPixelsRGBA32;    // 4 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight * GetTexPageCount() * 4
+    unsigned char*              TexPixelsBC4;       // BC4 blocks, 8 bytes per 4x4 pixels. Total size = ((TexWidth + 3) / 4) * ((TexHeight + 3) / 4) * 8 * GetTexPageCount()
     int                         TexWidth;           // Texture width calculated during Build().
-    int                         TexHeight;          // Texture height calculated during Build().
+    int                         TexHeight;          // Texture height calculated during Build(). Height of every page.
+    ImVector<ImTextureID>       TexPageIDs;         // Texture identifiers of pages 1+ (page 0 uses TexID). Use GetTexPageID()/SetTexPageID().
     ImVec2                      TexUvScale;         // = (1.0f/TexWidth, 1.0f/TexHeight)
     ImVec2                      TexUvWhitePixel;    // Texture coordinates to a white pixel
     ImVector<ImFont*>           Fonts;              // Hold all the fonts returned by AddFont*. Fonts[0] is the default font upon calling ImGui::NewFrame(), use ImGui::PushFont()/PopFont() to change the current font.
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVec4                      TexUvCheckerboard;  // UVs for baked alpha checkerboard pattern (IM_DRAWLIST_TEX_CHECKERBOARD_CELLS x IM_DRAWLIST_TEX_CHECKERBOARD_CELLS cells, top-left cell is opaque)
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
@@ -3426,6 +3533,7 @@ struct ImFontAtlas
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    int                         PackIdCheckerboard; // Custom texture rectangle ID for baked alpha checkerboard pattern
 
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -3436,13 +3544,18 @@ struct ImFontAtlas
 // ImFontAtlas automatically loads a default embedded font for you when you call GetTexDataAsAlpha8() or GetTexDataAsRGBA32().
 struct ImFont
 {
-    // [Internal] Members: Hot ~20/24 bytes (for CalcTextSize)
+    // [Internal] Members: Hot ~44/56 bytes (for CalcTextSize)
+    // Glyphs are indexed by code-point in pages of 256. The leading run of used pages (always including ASCII/Latin-1) is directly indexable
+    // with IndexAdvanceX[]/IndexLookup[], other used pages are stored in IndexPagesXXX[] and located with IndexPageMap[]. Unused pages all map to page 0.
     ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this info, and are often bottleneck in large UI).
     float                       FallbackAdvanceX;   // 4     // out // = FallbackGlyph->AdvanceX
     float                       FontSize;           // 4     // in  //            // Height of characters/line, set during loading (don't change after loading)
+    ImVector<ImU16>             IndexPageMap;       // 12-16 // out //            // Code-point >> 8 -> page number in IndexPagesXXX[]. Empty if all glyphs are in IndexAdvanceX[]/IndexLookup[].
+    ImVector<float>             IndexPagesAdvanceX; // 12-16 // out //            // 256 entries per page. Page 0 is the shared empty page.
 
-    // [Internal] Members: Hot ~28/40 bytes (for RenderText loop)
+    // [Internal] Members: Hot ~40/56 bytes (for RenderText loop)
     ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImU16>             IndexPagesLookup;   // 12-16 // out //            // 256 entries per page. Index into Glyphs[], (ImU16)-1 if missing.
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out //            // All glyphs.
     const ImFontGlyph*          FallbackGlyph;      // 4-8   // out // = FindGlyph(FontFallbackChar)
 
@@ -3467,7 +3580,7 @@ struct ImFont
     IMGUI_API ~ImFont();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c);
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c);
-    float                       GetCharAdvance(ImWchar c)           { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    float                       GetCharAdvance(ImWchar c)           { if ((int)c < IndexAdvanceX.Size) return IndexAdvanceX.Data[(int)c]; return ((int)c >> 8) < IndexPageMap.Size ? IndexPagesAdvanceX.Data[(IndexPageMap.Data[(int)c >> 8] << 8) + ((int)c & 0xFF)] : FallbackAdvanceX; }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
 
@@ -3482,7 +3595,7 @@ struct ImFont
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
     IMGUI_API void              GrowIndex(int new_size);
-    IMGUI_API void              AddGlyph(const ImFontConfig* src_cfg, ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
+    IMGUI_API void              AddGlyph(const ImFontConfig* src_cfg, ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x, int tex_page = 0);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetGlyphVisible(ImWchar c, bool visible);
     IMGUI_API bool              IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last);
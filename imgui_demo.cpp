@@ -520,6 +520,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
             // The "NoMouse" option can get us stuck with a disabled mouse! Let's provide an alternative way to fix it:
             if (io.ConfigFlags & ImGuiConfigFlags_NoMouse)
             {
+                ImGui::RequestRefresh(0.20f - fmodf((float)ImGui::GetTime(), 0.20f)); // Blinking: tell application when we need to be refreshed
                 if (fmodf((float)ImGui::GetTime(), 0.40f) < 0.20f)
                 {
                     ImGui::SameLine();
@@ -625,6 +626,8 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasMouseCursors",      &io.BackendFlags, ImGuiBackendFlags_HasMouseCursors);
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasSdfFonts",  &io.BackendFlags, ImGuiBackendFlags_RendererHasSdfFonts);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasTexPages",  &io.BackendFlags, ImGuiBackendFlags_RendererHasTexPages);
             ImGui::EndDisabled();
 
             ImGui::TreePop();
@@ -1003,6 +1006,7 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
             static float arr[] = { 0.6f, 0.1f, 1.0f, 0.5f, 0.92f, 0.1f, 0.2f };
             ImGui::PlotLines("Curve", arr, IM_ARRAYSIZE(arr));
             ImGui::Text("Sin(time) = %f", sinf((float)ImGui::GetTime()));
+            ImGui::RequestRefresh(); // Animated contents: request application to keep refreshing
             ImGui::EndTooltip();
         }
 
@@ -1021,6 +1025,7 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
         else if (always_on == 2 && ImGui::BeginTooltip())
         {
             ImGui::ProgressBar(sinf((float)ImGui::GetTime()) * 0.5f + 0.5f, ImVec2(ImGui::GetFontSize() * 25, 0.0f));
+            ImGui::RequestRefresh();
             ImGui::EndTooltip();
         }
 
@@ -1602,7 +1607,10 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
             const float time = (float)ImGui::GetTime();
             const bool winning_state = memchr(selected, 0, sizeof(selected)) == NULL; // If all cells are selected...
             if (winning_state)
+            {
+                ImGui::RequestRefresh();
                 ImGui::PushStyleVar(ImGuiStyleVar_SelectableTextAlign, ImVec2(0.5f + 0.5f * cosf(time * 2.0f), 0.5f + 0.5f * sinf(time * 3.0f)));
+            }
 
             for (int y = 0; y < 4; y++)
                 for (int x = 0; x < 4; x++)
@@ -2029,6 +2037,8 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
         static double refresh_time = 0.0;
         if (!animate || refresh_time == 0.0)
             refresh_time = ImGui::GetTime();
+        if (animate)
+            ImGui::RequestRefresh();
         while (refresh_time < ImGui::GetTime()) // Create data at fixed 60 Hz rate for the demo
         {
             static float phase = 0.0f;
@@ -2082,6 +2092,7 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
         // Animate a simple progress bar
         static float progress = 0.0f, progress_dir = 1.0f;
         progress += progress_dir * 0.4f * ImGui::GetIO().DeltaTime;
+        ImGui::RequestRefresh(); // Animated: request application to keep refreshing (see io.NextRefreshDelay)
         if (progress >= +1.1f) { progress = +1.1f; progress_dir *= -1.0f; }
         if (progress <= -0.1f) { progress = -0.1f; progress_dir *= -1.0f; }
 
@@ -2259,7 +2270,15 @@ static void ShowDemoWindowWidgets(ImGuiDemoWindowData* demo_data)
         if (display_mode == 2) flags |= ImGuiColorEditFlags_DisplayRGB;     // Override display mode
         if (display_mode == 3) flags |= ImGuiColorEditFlags_DisplayHSV;
         if (display_mode == 4) flags |= ImGuiColorEditFlags_DisplayHex;
+        ImDrawList* picker_draw_list = ImGui::GetWindowDrawList();
+        const int picker_vtx_start = picker_draw_list->VtxBuffer.Size;
         ImGui::ColorPicker4("MyColor##4", (float*)&color, flags, ref_color ? &ref_color_v.x : NULL);
+        const int picker_vtx_count = picker_draw_list->VtxBuffer.Size - picker_vtx_start;
+        const bool baked_checkerboard = (ImGui::GetIO().Fonts->Flags & ImFontAtlasFlags_NoBakedCheckerboard) == 0;
+        ImGui::Text("Picker used %d vertices (%s alpha checkerboard)", picker_vtx_count, baked_checkerboard ? "baked" : "non-baked");
+        ImGui::SameLine(); HelpMarker(
+            "The alpha checkerboard pattern is baked into the font atlas by default, which allows drawing it with a few textured quads "
+            "instead of one quad per checker cell.\n\nBuild the atlas with 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedCheckerboard' to compare.");
 
         ImGui::Text("Set defaults in code:");
         ImGui::SameLine(); HelpMarker(
@@ -3317,6 +3336,55 @@ static void ShowDemoWindowMultiSelect(ImGuiDemoWindowData* demo_data)
             ImGui::TreePop();
         }
 
+        // Demonstrate using ImGuiSelectionRangeStorage to store very large selections of index-addressable items.
+        // Box-selecting in a grid with BoxSelect2d while scrolling and moving left/right emits many small SetRange requests:
+        // ImGuiSelectionRangeStorage applies each of them with a cost proportional to the number of stored ranges.
+        IMGUI_DEMO_MARKER("Widgets/Selection State/Multi-Select (grid, with range storage)");
+        if (ImGui::TreeNode("Multi-Select (grid, with range storage)"))
+        {
+            static ImGuiSelectionRangeStorage selection;
+
+            ImGui::Text("Added features:");
+            ImGui::BulletText("Using ImGuiSelectionRangeStorage (indices stored as ranges).");
+            ImGui::BulletText("Using ImGuiMultiSelectFlags_BoxSelect2d + ImGuiListClipper on rows.");
+
+            const int ITEMS_COUNT = 200000;
+            const int COLUMNS_COUNT = 20;
+            const int ROWS_COUNT = ITEMS_COUNT / COLUMNS_COUNT;
+            ImGui::Text("Selection: %d/%d in %d ranges", selection.Size, ITEMS_COUNT, selection.GetRangesCount());
+            if (ImGui::BeginChild("##Grid", ImVec2(-FLT_MIN, ImGui::GetFontSize() * 20), ImGuiChildFlags_FrameStyle | ImGuiChildFlags_ResizeY))
+            {
+                ImGuiMultiSelectFlags flags = ImGuiMultiSelectFlags_ClearOnEscape | ImGuiMultiSelectFlags_ClearOnClickVoid | ImGuiMultiSelectFlags_BoxSelect2d;
+                ImGuiMultiSelectIO* ms_io = ImGui::BeginMultiSelect(flags, selection.Size, ITEMS_COUNT);
+                selection.ApplyRequests(ms_io);
+
+                const float item_size = ImGui::GetFrameHeight();
+                ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(2.0f, 2.0f));
+                ImGuiListClipper clipper;
+                clipper.Begin(ROWS_COUNT, item_size + 2.0f);
+                if (ms_io->RangeSrcItem != -1)
+                    clipper.IncludeItemByIndex((int)ms_io->RangeSrcItem / COLUMNS_COUNT); // Ensure RangeSrc item line is not clipped.
+                while (clipper.Step())
+                    for (int line_n = clipper.DisplayStart; line_n < clipper.DisplayEnd; line_n++)
+                        for (int column_n = 0; column_n < COLUMNS_COUNT; column_n++)
+                        {
+                            const int n = line_n * COLUMNS_COUNT + column_n;
+                            if (column_n > 0)
+                                ImGui::SameLine();
+                            ImGui::PushID(n);
+                            ImGui::SetNextItemSelectionUserData(n);
+                            ImGui::Selectable("", selection.Contains(n), ImGuiSelectableFlags_None, ImVec2(item_size, item_size));
+                            ImGui::PopID();
+                        }
+                ImGui::PopStyleVar();
+
+                ms_io = ImGui::EndMultiSelect();
+                selection.ApplyRequests(ms_io);
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
+
         // Demonstrate dynamic item list + deletion support using the BeginMultiSelect/EndMultiSelect API.
         // In order to support Deletion without any glitches you need to:
         // - (1) If items are submitted in their own scrolling area, submit contents size SetNextWindowContentSize() ahead of time to prevent one-frame readjustment of scrolling.
@@ -7802,8 +7870,10 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasSdfFonts)    ImGui::Text(" RendererHasSdfFonts");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasTexPages)    ImGui::Text(" RendererHasTexPages");
         ImGui::Separator();
-        ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight);
+        ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d, TexPages: %d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight, io.Fonts->GetTexPageCount());
         ImGui::Text("io.DisplaySize: %.2f,%.2f", io.DisplaySize.x, io.DisplaySize.y);
         ImGui::Text("io.DisplayFramebufferScale: %.2f,%.2f", io.DisplayFramebufferScale.x, io.DisplayFramebufferScale.y);
         ImGui::Separator();
@@ -9361,6 +9431,7 @@ static void ShowExampleAppWindowTitles(bool*)
     // Using "###" to display a changing title but keep a static identifier "AnimatedTitle"
     char buf[128];
     sprintf(buf, "Animated title %c %d###AnimatedTitle", "|/-\\"[(int)(ImGui::GetTime() / 0.25f) & 3], ImGui::GetFrameCount());
+    ImGui::RequestRefresh(0.25f - fmodf((float)ImGui::GetTime(), 0.25f));
     ImGui::SetNextWindowPos(ImVec2(base_pos.x + 100, base_pos.y + 300), ImGuiCond_FirstUseEver);
     ImGui::Begin(buf);
     ImGui::Text("This window has a changing title.");
@@ -39,6 +39,9 @@ Index of this file:
 #endif
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#ifdef IMGUI_THREAD_LOCAL_CONTEXT
+#include <atomic>       // std::atomic_flag, for ImFontBlob registry
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -787,7 +790,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
 
         // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
-        IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
+        IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SDF)));
 
         const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
@@ -2393,12 +2396,16 @@ ImFontConfig::ImFontConfig()
 // - ImFontAtlas::Clear()
 // - ImFontAtlas::GetTexDataAsAlpha8()
 // - ImFontAtlas::GetTexDataAsRGBA32()
+// - ImFontAtlasEncodeBC4Block() [Internal]
+// - ImFontAtlas::GetTexDataAsBC4()
 // - ImFontAtlas::AddFont()
 // - ImFontAtlas::AddFontDefault()
 // - ImFontAtlas::AddFontFromFileTTF()
 // - ImFontAtlas::AddFontFromMemoryTTF()
 // - ImFontAtlas::AddFontFromMemoryCompressedTTF()
 // - ImFontAtlas::AddFontFromMemoryCompressedBase85TTF()
+// - ImFontBlobCreateFromFile(), ImFontBlobCreateFromCompressed()
+// - ImFontBlobAddRef(), ImFontBlobRelease()
 // - ImFontAtlas::AddCustomRectRegular()
 // - ImFontAtlas::AddCustomRectFontGlyph()
 // - ImFontAtlas::CalcCustomRectUV()
@@ -2415,6 +2422,7 @@ ImFontConfig::ImFontConfig()
 // - ImFontAtlasBuildRender32bppRectFromString()
 // - ImFontAtlasBuildRenderDefaultTexData()
 // - ImFontAtlasBuildRenderLinesTexData()
+// - ImFontAtlasBuildRenderCheckerboardTexData()
 // - ImFontAtlasBuildInit()
 // - ImFontAtlasBuildFinish()
 //-----------------------------------------------------------------------------
@@ -2473,7 +2481,8 @@ ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
     TexGlyphPadding = 1;
-    PackIdMouseCursors = PackIdLines = -1;
+    TexSdfSpread = 4;
+    PackIdMouseCursors = PackIdLines = PackIdCheckerboard = -1;
 }
 
 ImFontAtlas::~ImFontAtlas()
@@ -2486,11 +2495,19 @@ void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     for (ImFontConfig& font_cfg : ConfigData)
-        if (font_cfg.FontData && font_cfg.FontDataOwnedByAtlas)
+    {
+        if (font_cfg.FontBlob)
+        {
+            ImFontBlobRelease(font_cfg.FontBlob);
+            font_cfg.FontBlob = NULL;
+            font_cfg.FontData = NULL;
+        }
+        else if (font_cfg.FontData && font_cfg.FontDataOwnedByAtlas)
         {
             IM_FREE(font_cfg.FontData);
             font_cfg.FontData = NULL;
         }
+    }
 
     // When clearing this we lose access to the font name and other information used to build the font.
     for (ImFont* font : Fonts)
@@ -2501,7 +2518,7 @@ void    ImFontAtlas::ClearInputData()
         }
     ConfigData.clear();
     CustomRects.clear();
-    PackIdMouseCursors = PackIdLines = -1;
+    PackIdMouseCursors = PackIdLines = PackIdCheckerboard = -1;
     // Important: we leave TexReady untouched
 }
 
@@ -2512,8 +2529,11 @@ void    ImFontAtlas::ClearTexData()
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
         IM_FREE(TexPixelsRGBA32);
+    if (TexPixelsBC4)
+        IM_FREE(TexPixelsBC4);
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
+    TexPixelsBC4 = NULL;
     TexPixelsUseColors = false;
     // Important: we leave TexReady untouched
 }
@@ -2554,10 +2574,11 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
         GetTexDataAsAlpha8(&pixels, NULL, NULL);
         if (pixels)
         {
-            TexPixelsRGBA32 = (unsigned int*)IM_ALLOC((size_t)TexWidth * (size_t)TexHeight * 4);
+            const int pixels_count = TexWidth * TexHeight * GetTexPageCount();
+            TexPixelsRGBA32 = (unsigned int*)IM_ALLOC((size_t)pixels_count * 4);
             const unsigned char* src = pixels;
             unsigned int* dst = TexPixelsRGBA32;
-            for (int n = TexWidth * TexHeight; n > 0; n--)
+            for (int n = pixels_count; n > 0; n--)
                 *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
         }
     }
@@ -2568,6 +2589,128 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
     if (out_bytes_per_pixel) *out_bytes_per_pixel = 4;
 }
 
+// Encode 4x4 pixels (row-major) into a 8 bytes BC4 block: two 8-bit endpoints followed by 16 3-bit palette indices.
+// - When endpoint0 > endpoint1 the palette is made of 8 values interpolated between the endpoints.
+// - Otherwise the palette is made of 6 interpolated values, plus exact 0 and 255, which suits anti-aliased glyph edges.
+// We try both and keep the one with the lowest error. Uniform blocks (the vast majority of a font atlas) are encoded losslessly.
+static void ImFontAtlasEncodeBC4Block(const unsigned char* src, unsigned char* dst)
+{
+    int min_all = 255, max_all = 0, min_inner = 255, max_inner = 0;
+    for (int n = 0; n < 16; n++)
+    {
+        const int v = src[n];
+        min_all = ImMin(min_all, v);
+        max_all = ImMax(max_all, v);
+        if (v != 0 && v != 255)
+        {
+            min_inner = ImMin(min_inner, v);
+            max_inner = ImMax(max_inner, v);
+        }
+    }
+    if (min_inner > max_inner)
+        min_inner = max_inner = 0;
+
+    ImU64 best_indices = 0;
+    int best_error = INT_MAX;
+    int best_e0 = min_all, best_e1 = min_all;
+    for (int mode = 0; mode < 2; mode++)
+    {
+        int palette[8];
+        int e0, e1;
+        if (mode == 0)
+        {
+            if (min_all == max_all)
+                continue;
+            e0 = max_all;
+            e1 = min_all;
+            palette[0] = e0;
+            palette[1] = e1;
+            for (int i = 1; i < 7; i++)
+                palette[i + 1] = ((7 - i) * e0 + i * e1 + 3) / 7;
+        }
+        else
+        {
+            e0 = min_inner;
+            e1 = max_inner;
+            palette[0] = e0;
+            palette[1] = e1;
+            for (int i = 1; i < 5; i++)
+                palette[i + 1] = ((5 - i) * e0 + i * e1 + 2) / 5;
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        ImU64 indices = 0;
+        int error = 0;
+        for (int n = 0; n < 16; n++)
+        {
+            int best_i = 0, best_d = INT_MAX;
+            for (int i = 0; i < 8; i++)
+            {
+                const int d = (src[n] - palette[i]) * (src[n] - palette[i]);
+                if (d < best_d)
+                {
+                    best_d = d;
+                    best_i = i;
+                }
+            }
+            indices |= (ImU64)best_i << (n * 3);
+            error += best_d;
+        }
+        if (error < best_error)
+        {
+            best_error = error;
+            best_indices = indices;
+            best_e0 = e0;
+            best_e1 = e1;
+        }
+    }
+
+    dst[0] = (unsigned char)best_e0;
+    dst[1] = (unsigned char)best_e1;
+    for (int n = 0; n < 6; n++)
+        dst[2 + n] = (unsigned char)(best_indices >> (n * 8));
+}
+
+void    ImFontAtlas::GetTexDataAsBC4(unsigned char** out_blocks, int* out_width, int* out_height, int* out_bytes_per_page)
+{
+    // Encode to BC4 format on demand
+    // Block-compressed textures are supported by most desktop GPUs (DXGI_FORMAT_BC4_UNORM, GL_COMPRESSED_RED_RGTC1, VK_FORMAT_BC4_UNORM_BLOCK).
+    // This is lossy: anti-aliased edges are quantized to 8 levels per 4x4 block, fully transparent/opaque areas are preserved.
+    if (!TexPixelsBC4)
+    {
+        unsigned char* pixels = NULL;
+        GetTexDataAsAlpha8(&pixels, NULL, NULL);
+        if (pixels)
+        {
+            const int blocks_w = (TexWidth + 3) / 4;
+            const int blocks_h = (TexHeight + 3) / 4;
+            const int tex_page_count = GetTexPageCount();
+            TexPixelsBC4 = (unsigned char*)IM_ALLOC((size_t)blocks_w * blocks_h * 8 * tex_page_count);
+            unsigned char* dst = TexPixelsBC4;
+            for (int tex_page = 0; tex_page < tex_page_count; tex_page++)
+            {
+                const unsigned char* src_page = pixels + (size_t)tex_page * TexWidth * TexHeight;
+                for (int by = 0; by < blocks_h; by++)
+                    for (int bx = 0; bx < blocks_w; bx++, dst += 8)
+                    {
+                        // Replicate last row/column of pixels when texture size is not a multiple of 4
+                        unsigned char block[16];
+                        for (int y = 0; y < 4; y++)
+                            for (int x = 0; x < 4; x++)
+                                block[y * 4 + x] = src_page[ImMin(by * 4 + y, TexHeight - 1) * TexWidth + ImMin(bx * 4 + x, TexWidth - 1)];
+                        ImFontAtlasEncodeBC4Block(block, dst);
+                    }
+            }
+        }
+    }
+
+    *out_blocks = TexPixelsBC4;
+    if (out_width) *out_width = TexWidth;
+    if (out_height) *out_height = TexHeight;
+    if (out_bytes_per_page) *out_bytes_per_page = ((TexWidth + 3) / 4) * ((TexHeight + 3) / 4) * 8;
+}
+
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
@@ -2586,7 +2729,14 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
     ImFontConfig& new_font_cfg = ConfigData.back();
     if (new_font_cfg.DstFont == NULL)
         new_font_cfg.DstFont = Fonts.back();
-    if (!new_font_cfg.FontDataOwnedByAtlas)
+    if (new_font_cfg.FontBlob)
+    {
+        // Shared data: no copy, hold a reference instead
+        IM_ASSERT(new_font_cfg.FontData == new_font_cfg.FontBlob->Data && (size_t)new_font_cfg.FontDataSize == new_font_cfg.FontBlob->DataSize);
+        ImFontBlobAddRef(new_font_cfg.FontBlob);
+        new_font_cfg.FontDataOwnedByAtlas = false;
+    }
+    else if (!new_font_cfg.FontDataOwnedByAtlas)
     {
         new_font_cfg.FontData = IM_ALLOC(new_font_cfg.FontDataSize);
         new_font_cfg.FontDataOwnedByAtlas = true;
@@ -2609,17 +2759,41 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 }
 
 // Default font TTF is compressed with stb_compress then base85 encoded (see misc/fonts/binary_to_compressed_c.cpp for encoder)
-static unsigned int stb_decompress_length(const unsigned char* input);
-static unsigned int stb_decompress(unsigned char* output, const unsigned char* input, unsigned int length);
 static unsigned int Decode85Byte(char c)                                    { return c >= '\\' ? c-36 : c-35; }
-static void         Decode85(const unsigned char* src, unsigned char* dst)
-{
-    while (*src)
+void ImDecode85(const char* src, size_t src_len, unsigned char* dst)
+{
+    IM_ASSERT(src_len % 5 == 0);
+#ifdef IMGUI_ENABLE_SSE4_2
+    // Decode 4 groups of 5 characters into 16 bytes at a time.
+    // - Digits pairs are combined with _mm_maddubs_epi16(): d0 + d1*85, d2 + d3*85 (max 7224)
+    // - Then with _mm_madd_epi16(): (d0 + d1*85) + (d2 + d3*85)*85^2 (max 52200624)
+    // - Then d4*85^4 is added with a 32-bit multiply, which may wrap around like the scalar version does.
+    const __m128i shuffle_pairs_0 = _mm_setr_epi8(0, 1, 2, 3, 5, 6, 7, 8, 10, 11, 12, 13, -1, -1, -1, -1);         // Characters 0..14 from src[0..15]
+    const __m128i shuffle_pairs_1 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 11, 12, 13, 14); // Characters 15..18 from src[4..19]
+    const __m128i shuffle_d4_0 = _mm_setr_epi8(4, -1, -1, -1, 9, -1, -1, -1, 14, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i shuffle_d4_1 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 15, -1, -1, -1);
+    const __m128i mul_85 = _mm_setr_epi8(1, 85, 1, 85, 1, 85, 1, 85, 1, 85, 1, 85, 1, 85, 1, 85);
+    const __m128i mul_85_2 = _mm_setr_epi16(1, 85 * 85, 1, 85 * 85, 1, 85 * 85, 1, 85 * 85);
+    const __m128i mul_85_4 = _mm_set1_epi32(85 * 85 * 85 * 85);
+    const __m128i char_35 = _mm_set1_epi8(35);
+    const __m128i char_91 = _mm_set1_epi8('\\' - 1);
+    for (; src_len >= 20; src_len -= 20, src += 20, dst += 16)
+    {
+        __m128i c0 = _mm_loadu_si128((const __m128i*)(const void*)src);
+        __m128i c1 = _mm_loadu_si128((const __m128i*)(const void*)(src + 4));
+        c0 = _mm_add_epi8(_mm_sub_epi8(c0, char_35), _mm_cmpgt_epi8(c0, char_91)); // Decode85Byte()
+        c1 = _mm_add_epi8(_mm_sub_epi8(c1, char_35), _mm_cmpgt_epi8(c1, char_91));
+        __m128i pairs = _mm_or_si128(_mm_shuffle_epi8(c0, shuffle_pairs_0), _mm_shuffle_epi8(c1, shuffle_pairs_1));
+        __m128i d4 = _mm_or_si128(_mm_shuffle_epi8(c0, shuffle_d4_0), _mm_shuffle_epi8(c1, shuffle_d4_1));
+        __m128i v = _mm_madd_epi16(_mm_maddubs_epi16(pairs, mul_85), mul_85_2);
+        v = _mm_add_epi32(v, _mm_mullo_epi32(d4, mul_85_4));
+        _mm_storeu_si128((__m128i*)(void*)dst, v);
+    }
+#endif
+    for (; src_len >= 5; src_len -= 5, src += 5, dst += 4)
     {
         unsigned int tmp = Decode85Byte(src[0]) + 85 * (Decode85Byte(src[1]) + 85 * (Decode85Byte(src[2]) + 85 * (Decode85Byte(src[3]) + 85 * Decode85Byte(src[4]))));
         dst[0] = ((tmp >> 0) & 0xFF); dst[1] = ((tmp >> 8) & 0xFF); dst[2] = ((tmp >> 16) & 0xFF); dst[3] = ((tmp >> 24) & 0xFF);   // We can't assume little-endianness.
-        src += 5;
-        dst += 4;
     }
 }
 #ifndef IMGUI_DISABLE_DEFAULT_FONT
@@ -2655,12 +2829,28 @@ ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig* font_cfg_template)
 #endif // #ifndef IMGUI_DISABLE_DEFAULT_FONT
 }
 
+// Add a font using shared data. Consume the caller's reference to 'blob'.
+static ImFont* ImFontAtlasAddFontFromBlob(ImFontAtlas* atlas, ImFontBlob* blob, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
+{
+    ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
+    IM_ASSERT(font_cfg.FontData == NULL);
+    IM_ASSERT(blob->DataSize > 100 && blob->DataSize <= (size_t)INT_MAX && "Incorrect font data size!");
+    font_cfg.FontData = blob->Data;
+    font_cfg.FontDataSize = (int)blob->DataSize;
+    font_cfg.FontBlob = blob;
+    font_cfg.SizePixels = size_pixels > 0.0f ? size_pixels : font_cfg.SizePixels;
+    if (glyph_ranges)
+        font_cfg.GlyphRanges = glyph_ranges;
+    ImFont* font = atlas->AddFont(&font_cfg); // Take its own reference
+    ImFontBlobRelease(blob);
+    return font;
+}
+
 ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
-    size_t data_size = 0;
-    void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
-    if (!data)
+    ImFontBlob* blob = ImFontBlobCreateFromFile(filename);
+    if (!blob)
     {
         IM_ASSERT_USER_ERROR(0, "Could not load font file!");
         return NULL;
@@ -2673,7 +2863,7 @@ ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels,
         for (p = filename + strlen(filename); p > filename && p[-1] != '/' && p[-1] != '\\'; p--) {}
         ImFormatString(font_cfg.Name, IM_ARRAYSIZE(font_cfg.Name), "%s, %.0fpx", p, size_pixels);
     }
-    return AddFontFromMemoryTTF(data, (int)data_size, size_pixels, &font_cfg, glyph_ranges);
+    return ImFontAtlasAddFontFromBlob(this, blob, size_pixels, &font_cfg, glyph_ranges);
 }
 
 // NB: Transfer ownership of 'ttf_data' to ImFontAtlas, unless font_cfg_template->FontDataOwnedByAtlas == false. Owned TTF buffer will be deleted after Build().
@@ -2693,24 +2883,201 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* font_data, int font_data_size, f
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
-    const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
-    unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
-    stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
-
-    ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
-    IM_ASSERT(font_cfg.FontData == NULL);
-    font_cfg.FontDataOwnedByAtlas = true;
-    return AddFontFromMemoryTTF(buf_decompressed_data, (int)buf_decompressed_size, size_pixels, &font_cfg, glyph_ranges);
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontBlob* blob = ImFontBlobCreateFromCompressed(compressed_ttf_data, (size_t)compressed_ttf_size, false);
+    if (!blob)
+    {
+        IM_ASSERT_USER_ERROR(0, "Could not decompress font data!");
+        return NULL;
+    }
+    return ImFontAtlasAddFontFromBlob(this, blob, size_pixels, font_cfg_template, glyph_ranges);
 }
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed_ttf_data_base85, float size_pixels, const ImFontConfig* font_cfg, const ImWchar* glyph_ranges)
 {
-    int compressed_ttf_size = (((int)strlen(compressed_ttf_data_base85) + 4) / 5) * 4;
-    void* compressed_ttf = IM_ALLOC((size_t)compressed_ttf_size);
-    Decode85((const unsigned char*)compressed_ttf_data_base85, (unsigned char*)compressed_ttf);
-    ImFont* font = AddFontFromMemoryCompressedTTF(compressed_ttf, compressed_ttf_size, size_pixels, font_cfg, glyph_ranges);
-    IM_FREE(compressed_ttf);
-    return font;
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontBlob* blob = ImFontBlobCreateFromCompressed(compressed_ttf_data_base85, strlen(compressed_ttf_data_base85), true);
+    if (!blob)
+    {
+        IM_ASSERT_USER_ERROR(0, "Could not decompress font data!");
+        return NULL;
+    }
+    return ImFontAtlasAddFontFromBlob(this, blob, size_pixels, font_cfg, glyph_ranges);
+}
+
+//-------------------------------------------------------------------------
+// Shared font data (ImFontBlob)
+//-------------------------------------------------------------------------
+// - Registry is a process-wide linked list: it is shared by all atlases and contexts, and must outlive them.
+// - With IMGUI_THREAD_LOCAL_CONTEXT, contexts and atlases living on different threads may add fonts or be destroyed concurrently,
+//   so the registry is protected by a spinlock. It is only held while searching/linking/unlinking, never while loading or
+//   decompressing: when two threads load the same source concurrently, the loser discards its copy and uses the registered one.
+//   Without IMGUI_THREAD_LOCAL_CONTEXT there is a single current context and the lock compiles to nothing.
+// - Each blob stores the allocator functions that were current when it was created, and frees all its memory with them.
+//   (the allocator may be thread-local, and the last reference may be released from another thread)
+//-------------------------------------------------------------------------
+
+static ImFontBlob*      GFontBlobs = NULL;
+#ifdef IMGUI_THREAD_LOCAL_CONTEXT
+static std::atomic_flag GFontBlobsLock = ATOMIC_FLAG_INIT;
+static void ImFontBlobsLock()   { while (GFontBlobsLock.test_and_set(std::memory_order_acquire)) {} }
+static void ImFontBlobsUnlock() { GFontBlobsLock.clear(std::memory_order_release); }
+#else
+static void ImFontBlobsLock()   {}
+static void ImFontBlobsUnlock() {}
+#endif
+
+// Find a matching blob and add a reference to it. Lock must be held.
+static ImFontBlob* ImFontBlobFindAndAddRef(ImFontBlobSource source, const char* filename, const void* source_data, size_t source_size, ImGuiID source_hash)
+{
+    for (ImFontBlob* blob = GFontBlobs; blob != NULL; blob = blob->Next)
+    {
+        if (blob->Source != source)
+            continue;
+        if (source == ImFontBlobSource_File ? (strcmp(blob->Filename, filename) != 0) : (blob->SourceData != source_data || blob->SourceSize != source_size || blob->SourceHash != source_hash))
+            continue;
+        blob->RefCount++;
+        return blob;
+    }
+    return NULL;
+}
+
+// Create an unregistered blob owning 'data' (allocated with IM_ALLOC() unless 'is_mapped').
+static ImFontBlob* ImFontBlobCreate(void* data, size_t data_size, bool is_mapped, ImFontBlobSource source)
+{
+    ImGuiMemAllocFunc alloc_func;
+    ImGuiMemFreeFunc free_func;
+    void* alloc_user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &alloc_user_data);
+    ImFontBlob* blob = IM_PLACEMENT_NEW(alloc_func(sizeof(ImFontBlob), alloc_user_data)) ImFontBlob();
+    blob->Data = data;
+    blob->DataSize = data_size;
+    blob->IsMapped = is_mapped;
+    blob->Source = source;
+    blob->AllocFunc = alloc_func;
+    blob->FreeFunc = free_func;
+    blob->AllocUserData = alloc_user_data;
+    return blob;
+}
+
+static void ImFontBlobDestroy(ImFontBlob* blob)
+{
+    if (blob->IsMapped)
+        ImFileUnmapFromMemory(blob->Data, blob->DataSize, true);
+    else if (blob->Data != NULL)
+        blob->FreeFunc(blob->Data, blob->AllocUserData);
+    if (blob->Filename != NULL)
+        blob->FreeFunc(blob->Filename, blob->AllocUserData);
+    ImGuiMemFreeFunc free_func = blob->FreeFunc;
+    void* alloc_user_data = blob->AllocUserData;
+    blob->~ImFontBlob();
+    free_func(blob, alloc_user_data);
+}
+
+// Register a newly created blob, unless another thread registered the same source meanwhile. Return a new reference.
+static ImFontBlob* ImFontBlobRegister(ImFontBlob* new_blob)
+{
+    ImFontBlobsLock();
+    ImFontBlob* blob = ImFontBlobFindAndAddRef(new_blob->Source, new_blob->Filename, new_blob->SourceData, new_blob->SourceSize, new_blob->SourceHash);
+    if (blob == NULL)
+    {
+        blob = new_blob;
+        blob->RefCount = 1;
+        blob->Next = GFontBlobs;
+        GFontBlobs = blob;
+    }
+    ImFontBlobsUnlock();
+    if (blob != new_blob)
+        ImFontBlobDestroy(new_blob);
+    return blob;
+}
+
+ImFontBlob* ImFontBlobCreateFromFile(const char* filename)
+{
+    ImFontBlobsLock();
+    ImFontBlob* blob = ImFontBlobFindAndAddRef(ImFontBlobSource_File, filename, NULL, 0, 0);
+    ImFontBlobsUnlock();
+    if (blob != NULL)
+        return blob;
+
+    size_t data_size = 0;
+    bool is_mapped = false;
+    void* data = ImFileMapToMemory(filename, &data_size, &is_mapped);
+    if (data == NULL)
+        return NULL;
+    blob = ImFontBlobCreate(data, data_size, is_mapped, ImFontBlobSource_File);
+    const size_t filename_size = strlen(filename) + 1;
+    blob->Filename = (char*)blob->AllocFunc(filename_size, blob->AllocUserData);
+    memcpy(blob->Filename, filename, filename_size);
+    return ImFontBlobRegister(blob);
+}
+
+ImFontBlob* ImFontBlobCreateFromCompressed(const void* compressed_data, size_t compressed_size, bool base85)
+{
+    const ImFontBlobSource source = base85 ? ImFontBlobSource_CompressedBase85 : ImFontBlobSource_Compressed;
+    // Compressed data is generally a static array: identify it by address, and check that it wasn't replaced by other data
+    // at the same address (e.g. a temporary buffer) with a hash of its first and last bytes. Hashing all of it would be slower than decompressing.
+    const size_t sample_size = ImMin(compressed_size, (size_t)256);
+    const ImGuiID source_hash = ImHashData((const char*)compressed_data + compressed_size - sample_size, sample_size, ImHashData(compressed_data, sample_size));
+    const void* source_data = compressed_data;
+    ImFontBlobsLock();
+    ImFontBlob* blob = ImFontBlobFindAndAddRef(source, NULL, source_data, compressed_size, source_hash);
+    ImFontBlobsUnlock();
+    if (blob != NULL)
+        return blob;
+
+    const size_t source_size = compressed_size;
+    void* decoded_data = NULL;
+    if (base85)
+    {
+        IM_ASSERT(compressed_size % 5 == 0 && "Incorrect Base85 data size!");
+        decoded_data = IM_ALLOC((compressed_size / 5) * 4);
+        ImDecode85((const char*)compressed_data, compressed_size, (unsigned char*)decoded_data);
+        compressed_data = decoded_data;
+        compressed_size = (compressed_size / 5) * 4;
+    }
+    const size_t buf_decompressed_size = ImFontDecompressGetSize(compressed_data, compressed_size);
+    unsigned char* buf_decompressed_data = buf_decompressed_size ? (unsigned char*)IM_ALLOC(buf_decompressed_size) : NULL;
+    if (buf_decompressed_data && !ImFontDecompress(buf_decompressed_data, buf_decompressed_size, compressed_data, compressed_size))
+    {
+        IM_FREE(buf_decompressed_data);
+        buf_decompressed_data = NULL;
+    }
+    if (decoded_data)
+        IM_FREE(decoded_data);
+    if (buf_decompressed_data == NULL)
+        return NULL;
+
+    blob = ImFontBlobCreate(buf_decompressed_data, buf_decompressed_size, false, source);
+    blob->SourceData = source_data;
+    blob->SourceSize = source_size;
+    blob->SourceHash = source_hash;
+    return ImFontBlobRegister(blob);
+}
+
+void ImFontBlobAddRef(ImFontBlob* blob)
+{
+    ImFontBlobsLock();
+    IM_ASSERT(blob->RefCount > 0);
+    blob->RefCount++;
+    ImFontBlobsUnlock();
+}
+
+void ImFontBlobRelease(ImFontBlob* blob)
+{
+    ImFontBlobsLock();
+    IM_ASSERT(blob->RefCount > 0);
+    const bool destroy = (--blob->RefCount == 0);
+    if (destroy)
+        for (ImFontBlob** p_blob = &GFontBlobs; *p_blob != NULL; p_blob = &(*p_blob)->Next)
+            if (*p_blob == blob)
+            {
+                *p_blob = blob->Next;
+                break;
+            }
+    ImFontBlobsUnlock();
+    if (destroy)
+        ImFontBlobDestroy(blob);
 }
 
 int ImFontAtlas::AddCustomRectRegular(int width, int height)
@@ -2866,6 +3233,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     // Clear atlas
     atlas->TexID = (ImTextureID)NULL;
+    atlas->TexPageIDs.clear();
     atlas->TexWidth = atlas->TexHeight = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
@@ -2974,6 +3342,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     int buf_rects_out_n = 0;
     int buf_packedchars_out_n = 0;
     const int pack_padding = atlas->TexGlyphPadding;
+    const int sdf_spread = (atlas->Flags & ImFontAtlasFlags_SDF) ? atlas->TexSdfSpread : 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
@@ -2992,19 +3361,22 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.array_of_unicode_codepoints = src_tmp.GlyphsList.Data;
         src_tmp.PackRange.num_chars = src_tmp.GlyphsList.Size;
         src_tmp.PackRange.chardata_for_range = src_tmp.PackedChars;
-        src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
-        src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
+        src_tmp.PackRange.h_oversample = (unsigned char)(sdf_spread ? 1 : cfg.OversampleH); // Distance fields are interpolated by the GPU, oversampling would only waste space.
+        src_tmp.PackRange.v_oversample = (unsigned char)(sdf_spread ? 1 : cfg.OversampleV);
 
         // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
         const float scale = (cfg.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels * cfg.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels * cfg.RasterizerDensity);
+        const int oversample_h = src_tmp.PackRange.h_oversample;
+        const int oversample_v = src_tmp.PackRange.v_oversample;
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
         {
             int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + pack_padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + pack_padding + cfg.OversampleV - 1);
+            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * oversample_h, scale * oversample_v, 0, 0, &x0, &y0, &x1, &y1);
+            const int sdf_padding = (x0 != x1 && y0 != y1) ? sdf_spread * 2 : 0; // stbtt_GetGlyphSDF() adds the spread on each side of non-empty glyphs
+            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + sdf_padding + pack_padding + oversample_h - 1);
+            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + sdf_padding + pack_padding + oversample_v - 1);
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
         }
     }
@@ -3020,23 +3392,26 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         atlas->TexWidth = atlas->TexDesiredWidth;
     else
         atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : 512;
+    if (atlas->TexPageSize > 0)
+        atlas->TexWidth = ImMin(atlas->TexWidth, atlas->TexPageSize);
 
     // 5. Start packing
     // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
     const int TEX_HEIGHT_MAX = 1024 * 32;
     stbtt_pack_context spc = {};
-    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, TEX_HEIGHT_MAX, 0, 0, NULL);
+    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, (atlas->TexPageSize > 0) ? atlas->TexPageSize : TEX_HEIGHT_MAX, 0, 0, NULL);
     spc.padding = atlas->TexGlyphPadding; // Because we mixup stbtt_PackXXX and stbrp_PackXXX there's a bit of a hack here, not passing the value to stbtt_PackBegin() allows us to still pack a TexWidth-1 wide item. (#8107)
     ImFontAtlasBuildPackCustomRects(atlas, spc.pack_info);
 
     // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
+    // With TexPageSize > 0, the texture is a stack of pages and rectangles spill into new pages when the current one is full.
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        stbrp_pack_rects((stbrp_context*)spc.pack_info, src_tmp.Rects, src_tmp.GlyphsCount);
+        ImFontAtlasBuildPackFontRects(atlas, spc.pack_info, spc.nodes, src_tmp.Rects, src_tmp.GlyphsCount);
 
         // Extend texture height and mark missing glyphs as non-packed so we won't render them.
         // FIXME: We are not handling packing failure here (would happen if we got off TEX_HEIGHT_MAX or if a single if larger than TexWidth?)
@@ -3047,11 +3422,14 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     // 7. Allocate texture
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
+    if (atlas->TexPageSize > 0)
+        atlas->TexHeight = (atlas->TexPageIDs.Size > 0) ? atlas->TexPageSize : ImMin(atlas->TexHeight, atlas->TexPageSize);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
-    atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
-    memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
+    const int tex_pixels_count = atlas->TexWidth * atlas->TexHeight * atlas->GetTexPageCount();
+    atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(tex_pixels_count);
+    memset(atlas->TexPixelsAlpha8, 0, tex_pixels_count);
     spc.pixels = atlas->TexPixelsAlpha8;
-    spc.height = atlas->TexHeight;
+    spc.height = atlas->TexHeight * atlas->GetTexPageCount();
 
     // 8. Render/rasterize font characters into the texture
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -3061,6 +3439,42 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (src_tmp.GlyphsCount == 0)
             continue;
 
+        if (sdf_spread > 0)
+        {
+            // Render signed distance fields: 128 on the glyph edge, increasing inside, decreasing outside, covering 'sdf_spread' pixels each way.
+            const float scale = (cfg.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels * cfg.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels * cfg.RasterizerDensity);
+            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
+            {
+                stbrp_rect* r = &src_tmp.Rects[glyph_i];
+                if (!r->was_packed)
+                    continue;
+                const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
+                int advance, lsb, w = 0, h = 0, xoff = 0, yoff = 0;
+                stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, glyph_index_in_font, &advance, &lsb);
+                unsigned char* sdf_pixels = stbtt_GetGlyphSDF(&src_tmp.FontInfo, scale, glyph_index_in_font, sdf_spread, 128, 128.0f / sdf_spread, &w, &h, &xoff, &yoff);
+                const int tx = r->x + pack_padding;
+                const int ty = r->y + pack_padding;
+                if (sdf_pixels != NULL)
+                {
+                    for (int y = 0; y < h; y++)
+                        memcpy(atlas->TexPixelsAlpha8 + (ty + y) * atlas->TexWidth + tx, sdf_pixels + y * w, (size_t)w);
+                    stbtt_FreeSDF(sdf_pixels, NULL);
+                }
+                stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
+                pc.x0 = (unsigned short)tx;
+                pc.y0 = (unsigned short)ty;
+                pc.x1 = (unsigned short)(tx + w);
+                pc.y1 = (unsigned short)(ty + h);
+                pc.xoff = (float)xoff;
+                pc.yoff = (float)yoff;
+                pc.xoff2 = (float)(xoff + w);
+                pc.yoff2 = (float)(yoff + h);
+                pc.xadvance = scale * advance;
+            }
+            src_tmp.Rects = NULL;
+            continue; // RasterizerMultiply doesn't apply to distances
+        }
+
         stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
 
         // Apply multiply operator
@@ -3110,11 +3524,12 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             stbtt_aligned_quad q;
             float unused_x = 0.0f, unused_y = 0.0f;
             stbtt_GetPackedQuad(src_tmp.PackedChars, atlas->TexWidth, atlas->TexHeight, glyph_i, &unused_x, &unused_y, &q, 0);
+            const int tex_page = pc.y0 / atlas->TexHeight; // Pages are stacked vertically, make V relative to the glyph's page
             float x0 = q.x0 * inv_rasterization_scale + font_off_x;
             float y0 = q.y0 * inv_rasterization_scale + font_off_y;
             float x1 = q.x1 * inv_rasterization_scale + font_off_x;
             float y1 = q.y1 * inv_rasterization_scale + font_off_y;
-            dst_font->AddGlyph(&cfg, (ImWchar)codepoint, x0, y0, x1, y1, q.s0, q.t0, q.s1, q.t1, pc.xadvance * inv_rasterization_scale);
+            dst_font->AddGlyph(&cfg, (ImWchar)codepoint, x0, y0, x1, y1, q.s0, q.t0 - tex_page, q.s1, q.t1 - tex_page, pc.xadvance * inv_rasterization_scale, tex_page);
         }
     }
 
@@ -3127,8 +3542,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
 const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
 {
-    static ImFontBuilderIO io;
-    io.FontBuilder_Build = ImFontAtlasBuildWithStbTruetype;
+    static const ImFontBuilderIO io = { ImFontAtlasBuildWithStbTruetype }; // Constant-initialized so atlases may be built concurrently from different threads
     return &io;
 }
 
@@ -3192,6 +3606,73 @@ void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opa
         }
 }
 
+// Pack glyph rectangles. When atlas->TexPageSize > 0, rectangles which don't fit in the current page are packed into new pages,
+// which are stacked vertically in the pixel data: page N covers rows [N * TexPageSize, (N + 1) * TexPageSize).
+// The packing context is reinitialized with its current size for each new page, previous pages are not revisited.
+// Rectangles are packed in batches following their order (= codepoint order), so that e.g. ASCII/Latin glyphs end up
+// in the same page and text rarely needs to switch texture. Packing everything at once would sort all glyphs by height.
+void ImFontAtlasBuildPackFontRects(ImFontAtlas* atlas, void* stbrp_context_opaque, void* stbrp_nodes_opaque, void* stbrp_rects_opaque, int rects_count)
+{
+    stbrp_context* pack_context = (stbrp_context*)stbrp_context_opaque;
+    stbrp_rect* rects = (stbrp_rect*)stbrp_rects_opaque;
+    if (atlas->TexPageSize <= 0)
+    {
+        stbrp_pack_rects(pack_context, rects, rects_count);
+        return;
+    }
+
+    const int BATCH_SIZE = 256;
+    ImVector<stbrp_rect> unpacked_rects;
+    for (int batch_start = 0; batch_start < rects_count; batch_start += BATCH_SIZE)
+    {
+        stbrp_rect* batch_rects = rects + batch_start;
+        const int batch_count = ImMin(rects_count - batch_start, BATCH_SIZE);
+        stbrp_pack_rects(pack_context, batch_rects, batch_count);
+
+        int page_y = atlas->TexPageIDs.Size * atlas->TexPageSize;
+        unpacked_rects.resize(0);
+        for (int i = 0; i < batch_count; i++)
+        {
+            if (batch_rects[i].was_packed)
+                batch_rects[i].y += page_y;
+            else
+            {
+                unpacked_rects.push_back(batch_rects[i]);
+                unpacked_rects.back().id = i;
+            }
+        }
+
+        // Open new pages until the batch is packed. Total height is limited by the 16-bit coordinates used by stb_truetype (TEX_HEIGHT_MAX).
+        while (unpacked_rects.Size > 0 && (atlas->TexPageIDs.Size + 2) * atlas->TexPageSize <= 1024 * 32)
+        {
+            stbrp_init_target(pack_context, pack_context->width, pack_context->height, (stbrp_node*)stbrp_nodes_opaque, pack_context->num_nodes);
+            stbrp_pack_rects(pack_context, unpacked_rects.Data, unpacked_rects.Size);
+            page_y = (atlas->TexPageIDs.Size + 1) * atlas->TexPageSize;
+            int unpacked_count = 0;
+            for (const stbrp_rect& r : unpacked_rects)
+            {
+                if (r.was_packed)
+                {
+                    batch_rects[r.id].x = r.x;
+                    batch_rects[r.id].y = r.y + page_y;
+                    batch_rects[r.id].was_packed = 1;
+                }
+                else
+                {
+                    unpacked_rects[unpacked_count++] = r;
+                }
+            }
+            if (unpacked_count == unpacked_rects.Size)
+            {
+                IM_ASSERT(0 && "Glyph is larger than TexPageSize!");
+                break;
+            }
+            atlas->TexPageIDs.push_back((ImTextureID)NULL);
+            unpacked_rects.resize(unpacked_count);
+        }
+    }
+}
+
 void ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value)
 {
     IM_ASSERT(x >= 0 && x + w <= atlas->TexWidth);
@@ -3254,7 +3735,7 @@ static void ImFontAtlasBuildRenderDefaultTexData(ImFontAtlas* atlas)
 
 static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas)
 {
-    if (atlas->Flags & ImFontAtlasFlags_NoBakedLines)
+    if (atlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SDF)) // Anti-aliased line gradients can't survive distance field thresholding
         return;
 
     // This generates a triangular shape in the texture, with the various line widths stacked on top of each other to allow interpolation between them
@@ -3303,9 +3784,40 @@ static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas)
     }
 }
 
+static void ImFontAtlasBuildRenderCheckerboardTexData(ImFontAtlas* atlas)
+{
+    if (atlas->Flags & ImFontAtlasFlags_NoBakedCheckerboard)
+        return;
+
+    // This generates a checkerboard pattern in the alpha channel, surrounded by a 1 texel border which continues the pattern,
+    // so bilinear filtering at the edges of the UV range never samples outside of it.
+    ImFontAtlasCustomRect* r = atlas->GetCustomRectByIndex(atlas->PackIdCheckerboard);
+    IM_ASSERT(r->IsPacked());
+    const int cell_size = IM_DRAWLIST_TEX_CHECKERBOARD_CELL_SIZE;
+    IM_ASSERT(r->Width == IM_DRAWLIST_TEX_CHECKERBOARD_CELLS * cell_size + 2 && r->Height == r->Width);
+    for (int y = 0; y < r->Height; y++)
+    {
+        const int cell_y = (y + cell_size - 1) / cell_size; // == floor((y - 1) / cell_size) + 1, keeping parity
+        for (int x = 0; x < r->Width; x++)
+        {
+            const int cell_x = (x + cell_size - 1) / cell_size;
+            const bool opaque = ((cell_x + cell_y) & 1) == 0;
+            const int offset = (r->X + x) + (r->Y + y) * atlas->TexWidth;
+            if (atlas->TexPixelsAlpha8 != NULL)
+                atlas->TexPixelsAlpha8[offset] = opaque ? 0xFF : 0x00;
+            else
+                atlas->TexPixelsRGBA32[offset] = opaque ? IM_COL32_WHITE : IM_COL32(255, 255, 255, 0);
+        }
+    }
+    atlas->TexUvCheckerboard = ImVec4((r->X + 1) * atlas->TexUvScale.x, (r->Y + 1) * atlas->TexUvScale.y, (r->X + r->Width - 1) * atlas->TexUvScale.x, (r->Y + r->Height - 1) * atlas->TexUvScale.y);
+}
+
 // Note: this is called / shared by both the stb_truetype and the FreeType builder
 void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 {
+    IM_ASSERT((!(atlas->Flags & ImFontAtlasFlags_SDF) || (atlas->TexSdfSpread >= 2 && atlas->TexSdfSpread <= 32)) && "TexSdfSpread must be between 2 and 32!");
+    IM_ASSERT((atlas->TexPageSize == 0 || (atlas->TexPageSize >= 256 && ImIsPowerOfTwo(atlas->TexPageSize))) && "TexPageSize must be 0 or a power-of-two >= 256!");
+
     // Register texture region for mouse cursors or standard white pixels
     if (atlas->PackIdMouseCursors < 0)
     {
@@ -3319,9 +3831,17 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
     // The +2 here is to give space for the end caps, whilst height +1 is to accommodate the fact we have a zero-width row
     if (atlas->PackIdLines < 0)
     {
-        if (!(atlas->Flags & ImFontAtlasFlags_NoBakedLines))
+        if (!(atlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SDF)))
             atlas->PackIdLines = atlas->AddCustomRectRegular(IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 2, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1);
     }
+
+    // Register texture region for alpha checkerboard (used by color widgets)
+    // The +2 here is to give space for a 1 texel border on each side
+    if (atlas->PackIdCheckerboard < 0)
+    {
+        if (!(atlas->Flags & ImFontAtlasFlags_NoBakedCheckerboard))
+            atlas->PackIdCheckerboard = atlas->AddCustomRectRegular(IM_DRAWLIST_TEX_CHECKERBOARD_CELLS * IM_DRAWLIST_TEX_CHECKERBOARD_CELL_SIZE + 2, IM_DRAWLIST_TEX_CHECKERBOARD_CELLS * IM_DRAWLIST_TEX_CHECKERBOARD_CELL_SIZE + 2);
+    }
 }
 
 // This is called/shared by both the stb_truetype and the FreeType builder.
@@ -3331,6 +3851,7 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     IM_ASSERT(atlas->TexPixelsAlpha8 != NULL || atlas->TexPixelsRGBA32 != NULL);
     ImFontAtlasBuildRenderDefaultTexData(atlas);
     ImFontAtlasBuildRenderLinesTexData(atlas);
+    ImFontAtlasBuildRenderCheckerboardTexData(atlas);
 
     // Register custom rectangle glyphs
     for (int i = 0; i < atlas->CustomRects.Size; i++)
@@ -3704,6 +4225,9 @@ void    ImFont::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPageMap.clear();
+    IndexPagesAdvanceX.clear();
+    IndexPagesLookup.clear();
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
@@ -3720,6 +4244,54 @@ static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_cha
     return 0;
 }
 
+// Return index into font->Glyphs[], or -1 if the code-point has no glyph
+static inline int FindGlyphIndex(const ImFont* font, unsigned int c)
+{
+    if (c < (unsigned int)font->IndexLookup.Size)
+    {
+        const ImWchar i = font->IndexLookup.Data[c];
+        return (i == (ImWchar)-1) ? -1 : (int)i;
+    }
+    if ((c >> 8) < (unsigned int)font->IndexPageMap.Size)
+    {
+        const ImU16 i = font->IndexPagesLookup.Data[(font->IndexPageMap.Data[c >> 8] << 8) + (c & 0xFF)];
+        return (i == (ImU16)-1) ? -1 : (int)i;
+    }
+    return -1;
+}
+
+// Write an index entry, allocating its 256 code-points page if needed (pages are initialized from the empty page 0)
+static void SetGlyphIndex(ImFont* font, unsigned int c, int glyph_idx, float advance_x)
+{
+    if (c < (unsigned int)font->IndexLookup.Size)
+    {
+        font->IndexAdvanceX.Data[c] = advance_x;
+        font->IndexLookup.Data[c] = (glyph_idx == -1) ? (ImWchar)-1 : (ImWchar)glyph_idx;
+        return;
+    }
+    if (font->IndexPagesLookup.Size == 0)
+    {
+        font->IndexPagesAdvanceX.resize(256, font->FallbackAdvanceX);
+        font->IndexPagesLookup.resize(256, (ImU16)-1);
+    }
+    const int page_n = (int)(c >> 8);
+    if (page_n >= font->IndexPageMap.Size)
+        font->IndexPageMap.resize(page_n + 1, 0);
+    if (font->IndexPageMap.Data[page_n] == 0)
+    {
+        const int page_offset = font->IndexPagesLookup.Size;
+        IM_ASSERT((page_offset >> 8) < 0xFFFF);
+        font->IndexPageMap.Data[page_n] = (ImU16)(page_offset >> 8);
+        font->IndexPagesAdvanceX.resize(page_offset + 256);
+        font->IndexPagesLookup.resize(page_offset + 256);
+        memcpy(font->IndexPagesAdvanceX.Data + page_offset, font->IndexPagesAdvanceX.Data, 256 * sizeof(float));
+        memcpy(font->IndexPagesLookup.Data + page_offset, font->IndexPagesLookup.Data, 256 * sizeof(ImU16));
+    }
+    const int n = (font->IndexPageMap.Data[page_n] << 8) + (int)(c & 0xFF);
+    font->IndexPagesAdvanceX.Data[n] = advance_x;
+    font->IndexPagesLookup.Data[n] = (ImU16)glyph_idx;
+}
+
 void ImFont::BuildLookupTable()
 {
     int max_codepoint = 0;
@@ -3727,18 +4299,36 @@ void ImFont::BuildLookupTable()
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
 
     // Build lookup table
+    // Only the leading run of used 256 code-points pages is stored densely (we always include the first page, for ASCII/Latin-1).
+    // Other used pages are allocated in IndexPagesXXX[], so e.g. merging a single emoji doesn't grow the tables up to U+1F600.
     IM_ASSERT(Glyphs.Size > 0 && "Font has not loaded glyph!");
     IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
+    ImBitVector used_pages;
+    used_pages.Create((max_codepoint >> 8) + 1);
+    for (int i = 0; i < Glyphs.Size; i++)
+        used_pages.SetBit((int)(Glyphs[i].Codepoint >> 8));
+    int dense_pages = 1;
+    while (dense_pages <= (max_codepoint >> 8) && used_pages.TestBit(dense_pages))
+        dense_pages++;
+
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPageMap.clear();
+    IndexPagesAdvanceX.clear();
+    IndexPagesLookup.clear();
     DirtyLookupTables = false;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
-    GrowIndex(max_codepoint + 1);
+    GrowIndex(ImMin(dense_pages * 256, max_codepoint + 1));
+    if (max_codepoint >= IndexLookup.Size)
+    {
+        // Shared empty page. Advances are set to FallbackAdvanceX below.
+        IndexPagesAdvanceX.resize(256, -1.0f);
+        IndexPagesLookup.resize(256, (ImU16)-1);
+    }
     for (int i = 0; i < Glyphs.Size; i++)
     {
         int codepoint = (int)Glyphs[i].Codepoint;
-        IndexAdvanceX[codepoint] = Glyphs[i].AdvanceX;
-        IndexLookup[codepoint] = (ImWchar)i;
+        SetGlyphIndex(this, (unsigned int)codepoint, i, Glyphs[i].AdvanceX);
 
         // Mark 4K page as used
         const int page_n = codepoint / 4096;
@@ -3755,8 +4345,7 @@ void ImFont::BuildLookupTable()
         tab_glyph = *FindGlyph((ImWchar)' ');
         tab_glyph.Codepoint = '\t';
         tab_glyph.AdvanceX *= IM_TABSIZE;
-        IndexAdvanceX[(int)tab_glyph.Codepoint] = (float)tab_glyph.AdvanceX;
-        IndexLookup[(int)tab_glyph.Codepoint] = (ImWchar)(Glyphs.Size - 1);
+        SetGlyphIndex(this, tab_glyph.Codepoint, Glyphs.Size - 1, tab_glyph.AdvanceX);
     }
 
     // Mark special glyphs as not visible (note that AddGlyph already mark as non-visible glyphs with zero-size polygons)
@@ -3777,9 +4366,12 @@ void ImFont::BuildLookupTable()
         }
     }
     FallbackAdvanceX = FallbackGlyph->AdvanceX;
-    for (int i = 0; i < max_codepoint + 1; i++)
+    for (int i = 0; i < IndexAdvanceX.Size; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
+    for (int i = 0; i < IndexPagesAdvanceX.Size; i++)
+        if (IndexPagesAdvanceX[i] < 0.0f)
+            IndexPagesAdvanceX[i] = FallbackAdvanceX;
 
     // Setup Ellipsis character. It is required for rendering elided text. We prefer using U+2026 (horizontal ellipsis).
     // However some old fonts may contain ellipsis at U+0085. Here we auto-detect most suitable ellipsis character.
@@ -3789,17 +4381,18 @@ void ImFont::BuildLookupTable()
     if (EllipsisChar == 0)
         EllipsisChar = FindFirstExistingGlyph(this, ellipsis_chars, IM_ARRAYSIZE(ellipsis_chars));
     const ImWchar dot_char = FindFirstExistingGlyph(this, dots_chars, IM_ARRAYSIZE(dots_chars));
+    const float sdf_inset = (ContainerAtlas->Flags & ImFontAtlasFlags_SDF) ? ContainerAtlas->TexSdfSpread / ConfigData->RasterizerDensity : 0.0f; // Distance field glyph quads extend beyond the visible shape
     if (EllipsisChar != 0)
     {
         EllipsisCharCount = 1;
-        EllipsisWidth = EllipsisCharStep = FindGlyph(EllipsisChar)->X1;
+        EllipsisWidth = EllipsisCharStep = FindGlyph(EllipsisChar)->X1 - sdf_inset;
     }
     else if (dot_char != 0)
     {
         const ImFontGlyph* glyph = FindGlyph(dot_char);
         EllipsisChar = dot_char;
         EllipsisCharCount = 3;
-        EllipsisCharStep = (glyph->X1 - glyph->X0) + 1.0f;
+        EllipsisCharStep = (glyph->X1 - glyph->X0 - sdf_inset * 2.0f) + 1.0f;
         EllipsisWidth = EllipsisCharStep * 3.0f - 1.0f;
     }
 }
@@ -3835,7 +4428,7 @@ void ImFont::GrowIndex(int new_size)
 // x0/y0/x1/y1 are offset from the character upper-left layout position, in pixels. Therefore x0/y0 are often fairly close to zero.
 // Not to be mistaken with texture coordinates, which are held by u0/v0/u1/v1 in normalized format (0.0..1.0 on each texture axis).
 // 'cfg' is not necessarily == 'this->ConfigData' because multiple source fonts+configs can be used to build one target font.
-void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x)
+void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x, int tex_page)
 {
     if (cfg != NULL)
     {
@@ -3863,6 +4456,7 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
     glyph.Codepoint = (unsigned int)codepoint;
     glyph.Visible = (x0 != x1) && (y0 != y1);
     glyph.Colored = false;
+    glyph.TexPage = (unsigned int)tex_page;
     glyph.X0 = x0;
     glyph.Y0 = y0;
     glyph.X1 = x1;
@@ -3883,35 +4477,30 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
-    unsigned int index_size = (unsigned int)IndexLookup.Size;
+    const int dst_glyph_idx = FindGlyphIndex(this, dst);
+    const int src_glyph_idx = FindGlyphIndex(this, src);
 
-    if (dst < index_size && IndexLookup.Data[dst] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
+    if (dst_glyph_idx != -1 && !overwrite_dst) // 'dst' already exists
         return;
-    if (src >= index_size && dst >= index_size) // both 'dst' and 'src' don't exist -> no-op
+    if (src_glyph_idx == -1 && dst_glyph_idx == -1) // both 'dst' and 'src' don't exist -> no-op
         return;
 
-    GrowIndex(dst + 1);
-    IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
-    IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    SetGlyphIndex(this, dst, src_glyph_idx, GetCharAdvance(src));
 }
 
 // Find glyph, return fallback if missing
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c)
 {
-    if (c >= (size_t)IndexLookup.Size)
-        return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
+    const int i = FindGlyphIndex(this, c);
+    if (i == -1)
         return FallbackGlyph;
     return &Glyphs.Data[i];
 }
 
 const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c)
 {
-    if (c >= (size_t)IndexLookup.Size)
-        return NULL;
-    const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
+    const int i = FindGlyphIndex(this, c);
+    if (i == -1)
         return NULL;
     return &Glyphs.Data[i];
 }
@@ -3926,7 +4515,7 @@ static inline const char* CalcWordWrapNextLineStartA(const char* text, const cha
     return text;
 }
 
-#define ImFontGetCharAdvanceX(_FONT, _CH)  ((int)(_CH) < (_FONT)->IndexAdvanceX.Size ? (_FONT)->IndexAdvanceX.Data[_CH] : (_FONT)->FallbackAdvanceX)
+#define ImFontGetCharAdvanceX(_FONT, _CH)  ((int)(_CH) < (_FONT)->IndexAdvanceX.Size ? (_FONT)->IndexAdvanceX.Data[_CH] : (_FONT)->GetCharAdvance((ImWchar)(_CH)))
 
 // Simple word-wrapping for English, not full-featured. Please submit failing cases!
 // This will return the next location to wrap from. If no wrapping if necessary, this will fast-forward to e.g. text_end.
@@ -4118,8 +4707,12 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
     float x = IM_TRUNC(pos.x);
     float y = IM_TRUNC(pos.y);
+    if (glyph->TexPage != 0)
+        draw_list->PushTextureID(ContainerAtlas->GetTexPageID(glyph->TexPage));
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale), ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
+    if (glyph->TexPage != 0)
+        draw_list->PopTextureID();
 }
 
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
@@ -4180,12 +4773,17 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
     const int vtx_count_max = (int)(text_end - s) * 4;
     const int idx_count_max = (int)(text_end - s) * 6;
-    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
     draw_list->PrimReserve(idx_count_max, vtx_count_max);
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
 
+    // Atlas with multiple texture pages: we assume the draw list starts with page 0 bound (as every ImDrawList drawing function
+    // expects the font atlas texture to be bound), and only split draw commands when consecutive visible glyphs change page.
+    unsigned int tex_page = 0;
+    const ImTextureID tex_id_backup = draw_list->_CmdHeader.TextureId;
+
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
 
@@ -4280,6 +4878,27 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                     }
                 }
 
+                // Switch texture page: give back unused vertices, change texture (adding a new draw command) and reserve again for the remaining characters
+                if (glyph->TexPage != tex_page)
+                {
+                    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data);
+                    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+                    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+                    draw_list->_VtxWritePtr = vtx_write;
+                    draw_list->_IdxWritePtr = idx_write;
+                    draw_list->_VtxCurrentIdx = vtx_index;
+                    tex_page = glyph->TexPage;
+                    draw_list->_CmdHeader.TextureId = ContainerAtlas->GetTexPageID(tex_page);
+                    draw_list->_OnChangedTextureID();
+
+                    const int char_count_max = (int)(text_end - s) + 1; // +1 for the current character
+                    idx_expected_size = draw_list->IdxBuffer.Size + char_count_max * 6;
+                    draw_list->PrimReserve(char_count_max * 6, char_count_max * 4);
+                    vtx_write = draw_list->_VtxWritePtr;
+                    idx_write = draw_list->_IdxWritePtr;
+                    vtx_index = draw_list->_VtxCurrentIdx;
+                }
+
                 // Support for untinted glyphs
                 ImU32 glyph_col = glyph->Colored ? col_untinted : col;
 
@@ -4307,6 +4926,13 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_index;
+
+    // Restore texture
+    if (tex_page != 0)
+    {
+        draw_list->_CmdHeader.TextureId = tex_id_backup;
+        draw_list->_OnChangedTextureID();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -4478,6 +5104,9 @@ void ImGui::RenderRectFilledWithHole(ImDrawList* draw_list, const ImRect& outer,
 // Helper for ColorPicker4()
 // NB: This is rather brittle and will show artifact when rounding this enabled if rounded corners overlap multiple cells. Caller currently responsible for avoiding that.
 // Spent a non reasonable amount of time trying to getting this right for ColorButton with rounding+anti-aliasing+ImGuiColorEditFlags_HalfAlphaPreview flag + various grid sizes and offsets, and eventually gave up... probably more reasonable to disable rounding altogether.
+// When the atlas has a baked checkerboard pattern (default, unless ImFontAtlasFlags_NoBakedCheckerboard is set) we draw the dark cells with a few
+// textured quads, each covering up to IM_DRAWLIST_TEX_CHECKERBOARD_CELLS x IM_DRAWLIST_TEX_CHECKERBOARD_CELLS cells, instead of one quad per cell.
+// Cells larger than IM_DRAWLIST_TEX_CHECKERBOARD_CELL_SIZE would be magnified with blurry edges, so they still use one quad per cell.
 // FIXME: uses ImGui::GetColorU32
 void ImGui::RenderColorRectWithAlphaCheckerboard(ImDrawList* draw_list, ImVec2 p_min, ImVec2 p_max, ImU32 col, float grid_step, ImVec2 grid_off, float rounding, ImDrawFlags flags)
 {
@@ -4489,6 +5118,44 @@ void ImGui::RenderColorRectWithAlphaCheckerboard(ImDrawList* draw_list, ImVec2 p
         ImU32 col_bg2 = GetColorU32(ImAlphaBlendColors(IM_COL32(128, 128, 128, 255), col));
         draw_list->AddRectFilled(p_min, p_max, col_bg1, rounding, flags);
 
+        ImFontAtlas* atlas = GImGui->Font->ContainerAtlas;
+        if (atlas->PackIdCheckerboard >= 0 && grid_step > 0.0f && grid_step <= (float)IM_DRAWLIST_TEX_CHECKERBOARD_CELL_SIZE)
+        {
+            // Work in cell units relative to the grid origin. Each quad starts within the first two cells of the pattern (preserving parity) and spans as many cells as the pattern allows.
+            const float pattern_cells = (float)IM_DRAWLIST_TEX_CHECKERBOARD_CELLS;
+            const ImVec2 grid_origin = p_min + grid_off;
+            const ImVec2 cells_min = (p_min - grid_origin) / grid_step;
+            const ImVec2 cells_max = (p_max - grid_origin) / grid_step;
+            const ImVec2 uv_origin(atlas->TexUvCheckerboard.x, atlas->TexUvCheckerboard.y);
+            const ImVec2 uv_per_cell = ImVec2(atlas->TexUvCheckerboard.z - atlas->TexUvCheckerboard.x, atlas->TexUvCheckerboard.w - atlas->TexUvCheckerboard.y) / pattern_cells;
+            for (float cy1 = cells_min.y; cy1 < cells_max.y; )
+            {
+                const float ty = cy1 - ImFloor(cy1 * 0.5f) * 2.0f;
+                const float cy2 = ImMin(cy1 + pattern_cells - ty, cells_max.y);
+                const float y1 = (cy1 <= cells_min.y) ? p_min.y : grid_origin.y + cy1 * grid_step;
+                const float y2 = (cy2 >= cells_max.y) ? p_max.y : grid_origin.y + cy2 * grid_step;
+                for (float cx1 = cells_min.x; cx1 < cells_max.x; )
+                {
+                    const float tx = cx1 - ImFloor(cx1 * 0.5f) * 2.0f;
+                    const float cx2 = ImMin(cx1 + pattern_cells - tx, cells_max.x);
+                    const float x1 = (cx1 <= cells_min.x) ? p_min.x : grid_origin.x + cx1 * grid_step;
+                    const float x2 = (cx2 >= cells_max.x) ? p_max.x : grid_origin.x + cx2 * grid_step;
+                    ImDrawFlags quad_flags = ImDrawFlags_RoundCornersNone;
+                    if (y1 <= p_min.y) { if (x1 <= p_min.x) quad_flags |= ImDrawFlags_RoundCornersTopLeft; if (x2 >= p_max.x) quad_flags |= ImDrawFlags_RoundCornersTopRight; }
+                    if (y2 >= p_max.y) { if (x1 <= p_min.x) quad_flags |= ImDrawFlags_RoundCornersBottomLeft; if (x2 >= p_max.x) quad_flags |= ImDrawFlags_RoundCornersBottomRight; }
+                    quad_flags &= flags;
+                    if ((quad_flags & ImDrawFlags_RoundCornersMask_) == 0)
+                        quad_flags = ImDrawFlags_RoundCornersNone;
+                    const ImVec2 uv1 = uv_origin + ImVec2(tx, ty) * uv_per_cell;
+                    const ImVec2 uv2 = uv_origin + ImVec2(tx + cx2 - cx1, ty + cy2 - cy1) * uv_per_cell;
+                    draw_list->AddImageRounded(atlas->TexID, ImVec2(x1, y1), ImVec2(x2, y2), uv1, uv2, col_bg2, rounding, quad_flags);
+                    cx1 = cx2;
+                }
+                cy1 = cy2;
+            }
+            return;
+        }
+
         int yi = 0;
         for (float y = p_min.y + grid_off.y; y < p_max.y; y += grid_step, yi++)
         {
@@ -4519,55 +5186,216 @@ void ImGui::RenderColorRectWithAlphaCheckerboard(ImDrawList* draw_list, ImVec2 p
 //-----------------------------------------------------------------------------
 // [SECTION] Decompression code
 //-----------------------------------------------------------------------------
-// Compressed with stb_compress() then converted to a C array and encoded as base85.
-// Use the program in misc/fonts/binary_to_compressed_c.cpp to create the array from a TTF file.
-// The purpose of encoding as base85 instead of "0x00,0x01,..." style is only save on _source code_ size.
-// Decompression from stb.h (public domain) by Sean Barrett https://github.com/nothings/stb/blob/master/stb.h
+// Use the program in misc/fonts/binary_to_compressed_c.cpp to create a C array from a TTF file. Two formats are supported:
+// - stb_compress() (default): decompression from stb.h (public domain) by Sean Barrett https://github.com/nothings/stb/blob/master/stb.h
+// - LZ4 blocks (-lz4): ~5x faster to decompress, and blocks may be decompressed in parallel.
+// The array may then be encoded as base85. The purpose of encoding as base85 instead of "0x00,0x01,..." style is only save on _source code_ size.
+//-----------------------------------------------------------------------------
+// - ImFontDecompressGetSize()
+// - ImFontDecompressGetBlockCount()
+// - ImFontDecompress()
+// - ImLz4DecompressBlock() [Internal]
+// - stb_decompress() [Internal]
 //-----------------------------------------------------------------------------
 
+// LZ4 blocks format, all values are 32-bit little-endian:
+// - Header: 'I','L','Z','4' signature, decompressed size, block size, block count.
+// - Compressed size of each block.
+// - Compressed blocks. Each block decompresses to 'block size' bytes (except the last one), without reference to other blocks.
+//   They are standard LZ4 blocks, see https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+#define IM_LZ4_BLOCKS_SIGNATURE     0x345A4C49  // "ILZ4"
+#define IM_LZ4_BLOCKS_HEADER_SIZE   16
+
+static unsigned int stb_decompress_length(const unsigned char* input);
+static unsigned int stb_decompress(unsigned char* output, const unsigned char* input, unsigned int length);
+static inline unsigned int ImReadLE32(const unsigned char* p) { return (unsigned int)p[0] | ((unsigned int)p[1] << 8) | ((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24); }
+
+static bool ImLz4BlocksIsValid(const unsigned char* src, size_t src_size)
+{
+    if (src_size < IM_LZ4_BLOCKS_HEADER_SIZE || ImReadLE32(src) != IM_LZ4_BLOCKS_SIGNATURE)
+        return false;
+    const unsigned int block_size = ImReadLE32(src + 8);
+    const unsigned int block_count = ImReadLE32(src + 12);
+    if (block_size == 0 || block_count != (ImReadLE32(src + 4) + (ImU64)block_size - 1) / block_size)
+        return false;
+    return (src_size - IM_LZ4_BLOCKS_HEADER_SIZE) / 4 >= block_count;
+}
+
+static bool ImFontDecompressIsStb(const unsigned char* src, size_t src_size)
+{
+    return src_size >= 16 && src[0] == 0x57 && src[1] == 0xBC && src[2] == 0 && src[3] == 0;
+}
+
+// Return decompressed size, or 0 if data is not recognized.
+size_t ImFontDecompressGetSize(const void* compressed_data, size_t compressed_size)
+{
+    const unsigned char* src = (const unsigned char*)compressed_data;
+    if (ImLz4BlocksIsValid(src, compressed_size))
+        return ImReadLE32(src + 4);
+    if (ImFontDecompressIsStb(src, compressed_size))
+        return stb_decompress_length(src);
+    return 0;
+}
+
+// Return number of independent blocks. stb_compress() data is a single block.
+int ImFontDecompressGetBlockCount(const void* compressed_data, size_t compressed_size)
+{
+    const unsigned char* src = (const unsigned char*)compressed_data;
+    if (ImLz4BlocksIsValid(src, compressed_size))
+        return (int)ImReadLE32(src + 12);
+    return ImFontDecompressIsStb(src, compressed_size) ? 1 : 0;
+}
+
+// Decompress a single LZ4 block. Every read and write is bounds checked, and writes never go past 'dst_end'.
+static bool ImLz4DecompressBlock(unsigned char* dst, unsigned char* dst_end, const unsigned char* src, const unsigned char* src_end)
+{
+    unsigned char* const dst_begin = dst;
+    for (;;)
+    {
+        if (src >= src_end)
+            return false;
+        const unsigned int token = *src++;
+
+        // Literals
+        size_t literal_len = token >> 4;
+        if (literal_len == 15)
+            for (unsigned int b = 255; b == 255; literal_len += b)
+            {
+                if (src >= src_end)
+                    return false;
+                b = *src++;
+            }
+        if ((size_t)(src_end - src) < literal_len || (size_t)(dst_end - dst) < literal_len)
+            return false;
+        if (literal_len <= 16 && src_end - src >= 16 && dst_end - dst >= 16)
+            memcpy(dst, src, 16); // Most literal runs are short: use a fixed size copy
+        else
+            memcpy(dst, src, literal_len);
+        src += literal_len;
+        dst += literal_len;
+        if (src == src_end)
+            return dst == dst_end; // Last sequence has no match
+
+        // Match
+        if (src_end - src < 2)
+            return false;
+        const size_t offset = (size_t)src[0] | ((size_t)src[1] << 8);
+        src += 2;
+        if (offset == 0 || offset > (size_t)(dst - dst_begin))
+            return false;
+        size_t match_len = token & 15;
+        if (match_len == 15)
+            for (unsigned int b = 255; b == 255; match_len += b)
+            {
+                if (src >= src_end)
+                    return false;
+                b = *src++;
+            }
+        match_len += 4;
+        if ((size_t)(dst_end - dst) < match_len)
+            return false;
+        const unsigned char* match = dst - offset;
+        if (offset >= 8 && (size_t)(dst_end - dst) >= match_len + 8)
+        {
+            // Copy 8 bytes at a time, possibly past the end of the match (overwritten by next sequence)
+            unsigned char* match_end = dst + match_len;
+            for (; dst < match_end; dst += 8, match += 8)
+                memcpy(dst, match, 8);
+            dst = match_end;
+        }
+        else
+        {
+            // Overlapping copy: repeat pattern
+            for (size_t n = 0; n < match_len; n++)
+                dst[n] = match[n];
+            dst += match_len;
+        }
+    }
+}
+
+// Decompress data created by binary_to_compressed_c.cpp. 'dst_size' must be ImFontDecompressGetSize().
+// LZ4 blocks may be decompressed from multiple threads, by calling this with different [block_begin, block_end) ranges.
+// Return false if data is not recognized or is corrupted.
+bool ImFontDecompress(void* dst, size_t dst_size, const void* compressed_data, size_t compressed_size, int block_begin, int block_end)
+{
+    const unsigned char* src = (const unsigned char*)compressed_data;
+    const int block_count = ImFontDecompressGetBlockCount(compressed_data, compressed_size);
+    if (block_end < 0)
+        block_end = block_count;
+    IM_ASSERT(block_begin >= 0 && block_begin <= block_end && block_end <= block_count);
+    if (block_count == 0 || block_end > block_count || dst_size != ImFontDecompressGetSize(compressed_data, compressed_size))
+        return false;
+
+    if (!ImLz4BlocksIsValid(src, compressed_size))
+        return stb_decompress((unsigned char*)dst, src, (unsigned int)compressed_size) == dst_size;
+
+    const size_t block_size = ImReadLE32(src + 8);
+    const unsigned char* block_sizes = src + IM_LZ4_BLOCKS_HEADER_SIZE;
+    size_t src_offset = IM_LZ4_BLOCKS_HEADER_SIZE + (size_t)block_count * 4;
+    for (int block_n = 0; block_n < block_begin; block_n++)
+        src_offset += ImReadLE32(block_sizes + block_n * 4);
+    for (int block_n = block_begin; block_n < block_end; block_n++)
+    {
+        const size_t block_src_size = ImReadLE32(block_sizes + block_n * 4);
+        if (src_offset > compressed_size || compressed_size - src_offset < block_src_size)
+            return false;
+        unsigned char* block_dst = (unsigned char*)dst + block_size * block_n;
+        unsigned char* block_dst_end = block_dst + ImMin(block_size, dst_size - block_size * block_n);
+        if (!ImLz4DecompressBlock(block_dst, block_dst_end, src + src_offset, src + src_offset + block_src_size))
+            return false;
+        src_offset += block_src_size;
+    }
+    return true;
+}
+
+// stb_compress() format. Decompression state is kept on the stack, so this may be called from multiple threads.
+struct stb__context
+{
+    unsigned char *barrier_out_e, *barrier_out_b;
+    const unsigned char *barrier_in_b;
+    unsigned char *dout;
+};
+
 static unsigned int stb_decompress_length(const unsigned char *input)
 {
     return (input[8] << 24) + (input[9] << 16) + (input[10] << 8) + input[11];
 }
 
-static unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
-static const unsigned char *stb__barrier_in_b;
-static unsigned char *stb__dout;
-static void stb__match(const unsigned char *data, unsigned int length)
+static void stb__match(stb__context *ctx, const unsigned char *data, unsigned int length)
 {
     // INVERSE of memmove... write each byte before copying the next...
-    IM_ASSERT(stb__dout + length <= stb__barrier_out_e);
-    if (stb__dout + length > stb__barrier_out_e) { stb__dout += length; return; }
-    if (data < stb__barrier_out_b) { stb__dout = stb__barrier_out_e+1; return; }
-    while (length--) *stb__dout++ = *data++;
+    IM_ASSERT(ctx->dout + length <= ctx->barrier_out_e);
+    if (ctx->dout + length > ctx->barrier_out_e) { ctx->dout += length; return; }
+    if (data < ctx->barrier_out_b) { ctx->dout = ctx->barrier_out_e+1; return; }
+    while (length--) *ctx->dout++ = *data++;
 }
 
-static void stb__lit(const unsigned char *data, unsigned int length)
+static void stb__lit(stb__context *ctx, const unsigned char *data, unsigned int length)
 {
-    IM_ASSERT(stb__dout + length <= stb__barrier_out_e);
-    if (stb__dout + length > stb__barrier_out_e) { stb__dout += length; return; }
-    if (data < stb__barrier_in_b) { stb__dout = stb__barrier_out_e+1; return; }
-    memcpy(stb__dout, data, length);
-    stb__dout += length;
+    IM_ASSERT(ctx->dout + length <= ctx->barrier_out_e);
+    if (ctx->dout + length > ctx->barrier_out_e) { ctx->dout += length; return; }
+    if (data < ctx->barrier_in_b) { ctx->dout = ctx->barrier_out_e+1; return; }
+    memcpy(ctx->dout, data, length);
+    ctx->dout += length;
 }
 
 #define stb__in2(x)   ((i[x] << 8) + i[(x)+1])
 #define stb__in3(x)   ((i[x] << 16) + stb__in2((x)+1))
 #define stb__in4(x)   ((i[x] << 24) + stb__in3((x)+1))
 
-static const unsigned char *stb_decompress_token(const unsigned char *i)
+static const unsigned char *stb_decompress_token(stb__context *ctx, const unsigned char *i)
 {
     if (*i >= 0x20) { // use fewer if's for cases that expand small
-        if (*i >= 0x80)       stb__match(stb__dout-i[1]-1, i[0] - 0x80 + 1), i += 2;
-        else if (*i >= 0x40)  stb__match(stb__dout-(stb__in2(0) - 0x4000 + 1), i[2]+1), i += 3;
-        else /* *i >= 0x20 */ stb__lit(i+1, i[0] - 0x20 + 1), i += 1 + (i[0] - 0x20 + 1);
+        if (*i >= 0x80)       stb__match(ctx, ctx->dout-i[1]-1, i[0] - 0x80 + 1), i += 2;
+        else if (*i >= 0x40)  stb__match(ctx, ctx->dout-(stb__in2(0) - 0x4000 + 1), i[2]+1), i += 3;
+        else /* *i >= 0x20 */ stb__lit(ctx, i+1, i[0] - 0x20 + 1), i += 1 + (i[0] - 0x20 + 1);
     } else { // more ifs for cases that expand large, since overhead is amortized
-        if (*i >= 0x18)       stb__match(stb__dout-(stb__in3(0) - 0x180000 + 1), i[3]+1), i += 4;
-        else if (*i >= 0x10)  stb__match(stb__dout-(stb__in3(0) - 0x100000 + 1), stb__in2(3)+1), i += 5;
-        else if (*i >= 0x08)  stb__lit(i+2, stb__in2(0) - 0x0800 + 1), i += 2 + (stb__in2(0) - 0x0800 + 1);
-        else if (*i == 0x07)  stb__lit(i+3, stb__in2(1) + 1), i += 3 + (stb__in2(1) + 1);
-        else if (*i == 0x06)  stb__match(stb__dout-(stb__in3(1)+1), i[4]+1), i += 5;
-        else if (*i == 0x04)  stb__match(stb__dout-(stb__in3(1)+1), stb__in2(4)+1), i += 6;
+        if (*i >= 0x18)       stb__match(ctx, ctx->dout-(stb__in3(0) - 0x180000 + 1), i[3]+1), i += 4;
+        else if (*i >= 0x10)  stb__match(ctx, ctx->dout-(stb__in3(0) - 0x100000 + 1), stb__in2(3)+1), i += 5;
+        else if (*i >= 0x08)  stb__lit(ctx, i+2, stb__in2(0) - 0x0800 + 1), i += 2 + (stb__in2(0) - 0x0800 + 1);
+        else if (*i == 0x07)  stb__lit(ctx, i+3, stb__in2(1) + 1), i += 3 + (stb__in2(1) + 1);
+        else if (*i == 0x06)  stb__match(ctx, ctx->dout-(stb__in3(1)+1), i[4]+1), i += 5;
+        else if (*i == 0x04)  stb__match(ctx, ctx->dout-(stb__in3(1)+1), stb__in2(4)+1), i += 6;
     }
     return i;
 }
@@ -4608,19 +5436,20 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
     if (stb__in4(0) != 0x57bC0000) return 0;
     if (stb__in4(4) != 0)          return 0; // error! stream is > 4GB
     const unsigned int olen = stb_decompress_length(i);
-    stb__barrier_in_b = i;
-    stb__barrier_out_e = output + olen;
-    stb__barrier_out_b = output;
+    stb__context ctx;
+    ctx.barrier_in_b = i;
+    ctx.barrier_out_e = output + olen;
+    ctx.barrier_out_b = output;
     i += 16;
 
-    stb__dout = output;
+    ctx.dout = output;
     for (;;) {
         const unsigned char *old_i = i;
-        i = stb_decompress_token(i);
+        i = stb_decompress_token(&ctx, i);
         if (i == old_i) {
             if (*i == 0x05 && i[1] == 0xfa) {
-                IM_ASSERT(stb__dout == output + olen);
-                if (stb__dout != output + olen) return 0;
+                IM_ASSERT(ctx.dout == output + olen);
+                if (ctx.dout != output + olen) return 0;
                 if (stb_adler32(1, output, olen) != (unsigned int) stb__in4(2))
                     return 0;
                 return olen;
@@ -4629,8 +5458,8 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
                 return 0;
             }
         }
-        IM_ASSERT(stb__dout <= output + olen);
-        if (stb__dout > output + olen)
+        IM_ASSERT(ctx.dout <= output + olen);
+        if (ctx.dout > output + olen)
             return 0;
     }
 }
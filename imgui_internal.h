@@ -142,6 +142,7 @@ struct ImGuiDataVarInfo;            // Variable information (e.g. to access styl
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
 struct ImGuiErrorRecoveryState;     // Storage of stack sizes for error handling and recovery
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
+struct ImGuiInputEventThreadQueue;  // Lock-free queue for input events posted from other threads
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiInputTextDeactivateData;// Short term storage to backup text of a deactivating InputText() while another is stealing active id
 struct ImGuiLastItemData;           // Status storage for last submitted items
@@ -203,8 +204,12 @@ typedef int ImGuiWindowRefreshFlags;    // -> enum ImGuiWindowRefreshFlags_ // F
 //-----------------------------------------------------------------------------
 
 #ifndef GImGui
+#ifdef IMGUI_THREAD_LOCAL_CONTEXT
+extern thread_local ImGuiContext* GImGui;   // Current implicit context pointer, per thread (not exported from a DLL: use ImGui::GetCurrentContext())
+#else
 extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] Macros
@@ -221,16 +226,17 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
 
 // Debug Logging for ShowDebugLogWindow(). This is designed for relatively rare events so please don't spam.
-#define IMGUI_DEBUG_LOG_ERROR(...)      do { ImGuiContext& g2 = *GImGui; if (g2.DebugLogFlags & ImGuiDebugLogFlags_EventError) IMGUI_DEBUG_LOG(__VA_ARGS__); else g2.DebugLogSkippedErrors++; } while (0)
-#define IMGUI_DEBUG_LOG_ACTIVEID(...)   do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventActiveId)    IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
-#define IMGUI_DEBUG_LOG_FOCUS(...)      do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventFocus)       IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
-#define IMGUI_DEBUG_LOG_POPUP(...)      do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventPopup)       IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
-#define IMGUI_DEBUG_LOG_NAV(...)        do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventNav)         IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
-#define IMGUI_DEBUG_LOG_SELECTION(...)  do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventSelection)   IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
-#define IMGUI_DEBUG_LOG_CLIPPER(...)    do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventClipper)     IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
-#define IMGUI_DEBUG_LOG_IO(...)         do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventIO)          IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
-#define IMGUI_DEBUG_LOG_FONT(...)       do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventFont)        IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
-#define IMGUI_DEBUG_LOG_INPUTROUTING(...) do{if (g.DebugLogFlags & ImGuiDebugLogFlags_EventInputRouting)IMGUI_DEBUG_LOG(__VA_ARGS__); } while (0)
+#define IMGUI_DEBUG_LOG_CATEGORY(_G, _CATEGORY, ...) do { (_G).DebugLogCurrentCategory = (_CATEGORY); IMGUI_DEBUG_LOG(__VA_ARGS__); (_G).DebugLogCurrentCategory = ImGuiDebugLogFlags_None; } while (0)
+#define IMGUI_DEBUG_LOG_ERROR(...)      do { ImGuiContext& g2 = *GImGui; if (g2.DebugLogFlags & ImGuiDebugLogFlags_EventError) IMGUI_DEBUG_LOG_CATEGORY(g2, ImGuiDebugLogFlags_EventError, __VA_ARGS__); else g2.DebugLogSkippedErrors++; } while (0)
+#define IMGUI_DEBUG_LOG_ACTIVEID(...)   do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventActiveId)    IMGUI_DEBUG_LOG_CATEGORY(g, ImGuiDebugLogFlags_EventActiveId, __VA_ARGS__); } while (0)
+#define IMGUI_DEBUG_LOG_FOCUS(...)      do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventFocus)       IMGUI_DEBUG_LOG_CATEGORY(g, ImGuiDebugLogFlags_EventFocus, __VA_ARGS__); } while (0)
+#define IMGUI_DEBUG_LOG_POPUP(...)      do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventPopup)       IMGUI_DEBUG_LOG_CATEGORY(g, ImGuiDebugLogFlags_EventPopup, __VA_ARGS__); } while (0)
+#define IMGUI_DEBUG_LOG_NAV(...)        do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventNav)         IMGUI_DEBUG_LOG_CATEGORY(g, ImGuiDebugLogFlags_EventNav, __VA_ARGS__); } while (0)
+#define IMGUI_DEBUG_LOG_SELECTION(...)  do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventSelection)   IMGUI_DEBUG_LOG_CATEGORY(g, ImGuiDebugLogFlags_EventSelection, __VA_ARGS__); } while (0)
+#define IMGUI_DEBUG_LOG_CLIPPER(...)    do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventClipper)     IMGUI_DEBUG_LOG_CATEGORY(g, ImGuiDebugLogFlags_EventClipper, __VA_ARGS__); } while (0)
+#define IMGUI_DEBUG_LOG_IO(...)         do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventIO)          IMGUI_DEBUG_LOG_CATEGORY(g, ImGuiDebugLogFlags_EventIO, __VA_ARGS__); } while (0)
+#define IMGUI_DEBUG_LOG_FONT(...)       do { if (g.DebugLogFlags & ImGuiDebugLogFlags_EventFont)        IMGUI_DEBUG_LOG_CATEGORY(g, ImGuiDebugLogFlags_EventFont, __VA_ARGS__); } while (0)
+#define IMGUI_DEBUG_LOG_INPUTROUTING(...) do{if (g.DebugLogFlags & ImGuiDebugLogFlags_EventInputRouting)IMGUI_DEBUG_LOG_CATEGORY(g, ImGuiDebugLogFlags_EventInputRouting, __VA_ARGS__); } while (0)
 
 // Static Asserts
 #define IM_STATIC_ASSERT(_COND)         static_assert(_COND, "")
@@ -339,6 +345,7 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // - Helper: ImBitArray
 // - Helper: ImBitVector
 // - Helper: ImSpan<>, ImSpanAllocator<>
+// - Helper: ImSmallVector<>
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
 // - Helper: ImGuiTextIndex
@@ -348,6 +355,7 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // Helpers: Hashing
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImGuiID seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImGuiID seed = 0);
+IMGUI_API ImGuiID       ImHashStr(const ImGuiHashedStr& str, ImGuiID seed = 0);   // == ImHashStr(str.Str, 0, seed), using hash precomputed at compile time
 
 // Helpers: Sorting
 #ifndef ImQsort
@@ -426,6 +434,8 @@ IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 coun
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
+IMGUI_API void*             ImFileMapToMemory(const char* filename, size_t* out_file_size, bool* out_is_mapped);  // Read-only. Fallback to ImFileLoadToMemory() if mapping is not available.
+IMGUI_API void              ImFileUnmapFromMemory(void* data, size_t file_size, bool is_mapped);
 
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
@@ -663,6 +673,138 @@ struct ImSpanAllocator
     inline void  GetSpan(int n, ImSpan<T>* span)    { span->set((T*)GetSpanPtrBegin(n), (T*)GetSpanPtrEnd(n)); }
 };
 
+// Helper: ImSmallVector<>
+// Same as ImVector<> but storing up to N elements inline, only allocating from the heap when growing past N.
+// - Useful for containers which are generally small, to reduce heap traffic (e.g. hundreds of small tables).
+// - Same as ImVector<>, contents are treated as raw data: no constructor/destructor calls.
+// - A zero-cleared instance is a valid empty instance, and the structure may be relocated with memcpy() (e.g. when stored in ImPool<>):
+//   we never store a pointer to our inline storage so use data() instead of a Data field.
+//   Pointers to elements stored inline are invalidated when the owner is relocated.
+IM_MSVC_RUNTIME_CHECKS_OFF
+template<typename T, int N>
+struct ImSmallVector
+{
+    int                 Size;
+    int                 Capacity;           // Capacity of HeapData, 0 while using inline storage
+    T*                  HeapData;           // NULL while using inline storage
+    T                   LocalData[N];
+
+    // Constructors, destructor
+    inline ImSmallVector()                                          { Size = Capacity = 0; HeapData = NULL; }
+    inline ImSmallVector(const ImSmallVector<T, N>& src)            { Size = Capacity = 0; HeapData = NULL; operator=(src); }
+    inline ImSmallVector<T, N>& operator=(const ImSmallVector<T, N>& src) { if (&src != this) { resize(0); resize(src.Size); memcpy(data(), src.data(), (size_t)Size * sizeof(T)); } return *this; }
+    inline ~ImSmallVector()                                         { if (HeapData) IM_FREE(HeapData); } // Important: does not destruct anything
+
+    inline void         clear()                                     { if (HeapData) { IM_FREE(HeapData); HeapData = NULL; } Size = Capacity = 0; } // Important: does not destruct anything
+
+    inline T*           data()                                      { return HeapData ? HeapData : LocalData; }
+    inline const T*     data() const                                { return HeapData ? HeapData : LocalData; }
+    inline bool         empty() const                               { return Size == 0; }
+    inline int          size() const                                { return Size; }
+    inline int          size_in_bytes() const                       { return Size * (int)sizeof(T); }
+    inline int          capacity() const                            { return HeapData ? Capacity : N; }
+    inline bool         is_inline() const                           { return HeapData == NULL; }
+    inline T&           operator[](int i)                           { IM_ASSERT(i >= 0 && i < Size); return data()[i]; }
+    inline const T&     operator[](int i) const                     { IM_ASSERT(i >= 0 && i < Size); return data()[i]; }
+
+    inline T*           begin()                                     { return data(); }
+    inline const T*     begin() const                               { return data(); }
+    inline T*           end()                                       { return data() + Size; }
+    inline const T*     end() const                                 { return data() + Size; }
+    inline T&           front()                                     { IM_ASSERT(Size > 0); return data()[0]; }
+    inline const T&     front() const                               { IM_ASSERT(Size > 0); return data()[0]; }
+    inline T&           back()                                      { IM_ASSERT(Size > 0); return data()[Size - 1]; }
+    inline const T&     back() const                                { IM_ASSERT(Size > 0); return data()[Size - 1]; }
+
+    inline int          _grow_capacity(int sz) const                { int new_capacity = capacity() + capacity() / 2; return new_capacity > sz ? new_capacity : sz; }
+    inline void         resize(int new_size)                        { if (new_size > capacity()) reserve(_grow_capacity(new_size)); Size = new_size; }
+    inline void         shrink(int new_size)                        { IM_ASSERT(new_size <= Size); Size = new_size; }
+    inline void         reserve(int new_capacity)                   { if (new_capacity <= capacity()) return; T* new_data = (T*)IM_ALLOC((size_t)new_capacity * sizeof(T)); memcpy(new_data, data(), (size_t)Size * sizeof(T)); if (HeapData) IM_FREE(HeapData); HeapData = new_data; Capacity = new_capacity; }
+
+    // NB: It is illegal to call push_back with a reference pointing inside the vector data itself! e.g. v.push_back(v[10]) is forbidden.
+    inline void         push_back(const T& v)                       { if (Size == capacity()) reserve(_grow_capacity(Size + 1)); memcpy(&data()[Size], &v, sizeof(v)); Size++; }
+    inline void         pop_back()                                  { IM_ASSERT(Size > 0); Size--; }
+    inline T*           erase(const T* it)                          { T* d = data(); IM_ASSERT(it >= d && it < d + Size); const ptrdiff_t off = it - d; memmove(d + off, d + off + 1, ((size_t)Size - (size_t)off - 1) * sizeof(T)); Size--; return d + off; }
+    inline int          index_from_ptr(const T* it) const           { const T* d = data(); IM_ASSERT(it >= d && it < d + Size); const ptrdiff_t off = it - d; return (int)off; }
+};
+IM_MSVC_RUNTIME_CHECKS_RESTORE
+
+// Helper: ImFrameArena
+// Linear allocator for transient data which doesn't outlive the current frame. Reset() is called by NewFrame().
+// - Memory is allocated in blocks which are kept across frames. When a frame needed more than one block, blocks are
+//   merged on the next Reset(), so allocations quickly converge to zero calls to MemAlloc()/MemFree() per frame.
+// - Large allocations (>= HeapAllocSizeMin) are not served from blocks: they are forwarded to MemAlloc() and freed on next Reset(),
+//   so a single large transient buffer (e.g. pasting a large text) doesn't stay reserved.
+// - Reserved memory shrinks back toward recent usage: after 'compact_timer' seconds, blocks are reallocated to fit the
+//   largest frame of that period. Pass a negative 'compact_timer' to disable (NewFrame() passes io.ConfigMemoryCompactTimer).
+// - Nothing is allocated until first used.
+struct IMGUI_API ImFrameArena
+{
+    struct Block { char* Data; int Size; };
+    ImVector<Block>     Blocks;
+    ImVector<void*>     HeapAllocs;             // Large allocations made since last Reset()
+    int                 BlockSizeMin;           // Minimum size of a block (default to 64 KB)
+    int                 HeapAllocSizeMin;       // Minimum size of an allocation forwarded to MemAlloc() (default to 64 KB)
+    int                 CurrBlock;              // Index of block we are currently allocating from
+    int                 CurrOffset;             // Offset into current block
+    int                 FrameCount;             // Incremented on every Reset(), used to detect stale ImFrameVector<>
+    int                 UsedBytes;              // Bytes allocated from blocks since last Reset() (including alignment padding)
+    int                 UsedBytesPrevFrame;     // Bytes allocated from blocks during previous frame
+    int                 UsedBytesHighWaterMark; // Maximum bytes allocated from blocks during a frame
+    int                 UsedBytesCompactMax;    // Maximum bytes allocated from blocks during a frame, since CompactTime
+    int                 ReservedBytes;          // Sum of blocks sizes
+    int                 HeapAllocsPrevFrame;    // Number of large allocations during previous frame
+    double              CompactTime;            // Time of last compaction check
+
+    ImFrameArena()      { BlockSizeMin = HeapAllocSizeMin = 64 * 1024; CurrBlock = CurrOffset = FrameCount = UsedBytes = UsedBytesPrevFrame = UsedBytesHighWaterMark = UsedBytesCompactMax = ReservedBytes = HeapAllocsPrevFrame = 0; CompactTime = 0.0; }
+    ~ImFrameArena()     { ClearFreeMemory(); }
+    void*               Alloc(size_t size);     // Returned memory is aligned on 16 bytes and valid until next Reset()
+    void                Reset(double time = 0.0, float compact_timer = -1.0f);
+    void                ClearFreeMemory();
+};
+
+// Helper: ImFrameVector<>
+// Same as ImVector<> but allocating from an ImFrameArena. Freeing is a no-op, contents are valid until the arena is Reset().
+// - Intended for local temporary arrays in code which may run every frame, e.g. 'ImFrameVector<char> buf(&g.FrameArena);'
+// - Same as ImVector<>, contents are treated as raw data: no constructor/destructor calls.
+IM_MSVC_RUNTIME_CHECKS_OFF
+template<typename T>
+struct ImFrameVector
+{
+    int                 Size;
+    int                 Capacity;
+    T*                  Data;
+    ImFrameArena*       Arena;
+    int                 ArenaFrameCount;
+
+    inline ImFrameVector(ImFrameArena* arena)                   { Size = Capacity = 0; Data = NULL; Arena = arena; ArenaFrameCount = arena->FrameCount; }
+
+    inline void         clear()                                 { Size = Capacity = 0; Data = NULL; }
+    inline bool         empty() const                           { return Size == 0; }
+    inline int          size() const                            { return Size; }
+    inline int          size_in_bytes() const                   { return Size * (int)sizeof(T); }
+    inline int          capacity() const                        { return Capacity; }
+    inline T&           operator[](int i)                       { IM_ASSERT(i >= 0 && i < Size); return Data[i]; }
+    inline const T&     operator[](int i) const                 { IM_ASSERT(i >= 0 && i < Size); return Data[i]; }
+
+    inline T*           begin()                                 { return Data; }
+    inline const T*     begin() const                           { return Data; }
+    inline T*           end()                                   { return Data + Size; }
+    inline const T*     end() const                             { return Data + Size; }
+    inline T&           back()                                  { IM_ASSERT(Size > 0); return Data[Size - 1]; }
+    inline const T&     back() const                            { IM_ASSERT(Size > 0); return Data[Size - 1]; }
+
+    inline int          _grow_capacity(int sz) const            { int new_capacity = Capacity ? (Capacity + Capacity / 2) : 8; return new_capacity > sz ? new_capacity : sz; }
+    inline void         resize(int new_size)                    { if (new_size > Capacity) reserve(_grow_capacity(new_size)); Size = new_size; }
+    inline void         shrink(int new_size)                    { IM_ASSERT(new_size <= Size); Size = new_size; }
+    inline void         reserve(int new_capacity)               { if (new_capacity <= Capacity) return; IM_ASSERT(ArenaFrameCount == Arena->FrameCount && "ImFrameVector<> used after its arena was Reset()!"); T* new_data = (T*)Arena->Alloc((size_t)new_capacity * sizeof(T)); if (Data) memcpy(new_data, Data, (size_t)Size * sizeof(T)); Data = new_data; Capacity = new_capacity; }
+
+    // NB: It is illegal to call push_back with a reference pointing inside the vector data itself! e.g. v.push_back(v[10]) is forbidden.
+    inline void         push_back(const T& v)                   { if (Size == Capacity) reserve(_grow_capacity(Size + 1)); memcpy(&Data[Size], &v, sizeof(v)); Size++; }
+    inline void         pop_back()                              { IM_ASSERT(Size > 0); Size--; }
+};
+IM_MSVC_RUNTIME_CHECKS_RESTORE
+
 // Helper: ImPool<>
 // Basic keyed storage for contiguous instances, slow/amortized insertion, O(1) indexable, O(Log N) queries by ID over a dense/hot buffer,
 // Honor constructor/destructor. Add/remove invalidate all pointers. Indexes have the same lifetime as the associated object.
@@ -733,6 +875,50 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: Fixed-capacity ring buffer of text lines (used by the Debug Log)
+// - Each line is stored contiguously, wrapping to the start of the buffer when it doesn't fit before the end.
+// - Storage grows on demand up to the capacity given to Create(). Once it is reached, oldest lines are evicted in O(1)
+//   to make room for new ones. The line index is itself a ring, nothing is ever moved.
+// - Each line carries user flags (e.g. ImGuiDebugLogFlags category) which may be used for filtering at display time.
+// - append() behaves like a text stream: text after the last '\n' is continued by the next call.
+struct ImGuiTextRingLine
+{
+    int             Offset;                                 // Offset in Buf
+    int             Length;                                 // Length excluding the trailing '\n' which is also stored
+    ImU32           Flags;
+};
+
+struct IMGUI_API ImGuiTextRingBuffer
+{
+    ImVector<char>              Buf;                        // Grows up to BufCapacity, then wraps
+    ImVector<ImGuiTextRingLine> Lines;                      // Grows up to LinesCapacity, then wraps. Oldest line at LinesHead
+    int                         BufCapacity = 0;            // Set by Create()
+    int                         LinesCapacity = 0;          // Set by Create()
+    int                         LinesHead = 0;
+    int                         LinesCount = 0;
+    int                         WriteOffset = 0;            // Where next line will be written
+    int                         EvictedCount = 0;           // Number of lines evicted since last Clear()
+    bool                        LastLineOpen = false;       // Last text appended had no trailing '\n': next append() continues its last line
+    ImVector<char>              TempBuf;
+
+    void            Create(int buf_size, int max_lines);
+    void            Clear()                                 { LinesHead = LinesCount = WriteOffset = EvictedCount = 0; LastLineOpen = false; }
+    void            ClearFreeMemory()                       { Clear(); Buf.clear(); Lines.clear(); TempBuf.clear(); }
+    bool            IsCreated() const                       { return BufCapacity > 0; }
+    int             size() const                            { return LinesCount; }
+    const ImGuiTextRingLine& get_line(int n) const          { IM_ASSERT(n >= 0 && n < LinesCount); return Lines.Data[(LinesHead + n) % Lines.Size]; }
+    const char*     get_line_begin(int n) const             { return Buf.Data + get_line(n).Offset; }
+    const char*     get_line_end(int n) const               { const ImGuiTextRingLine& line = get_line(n); return Buf.Data + line.Offset + line.Length; }
+    void            append(const char* text, const char* text_end, ImU32 flags);
+    void            append_line(const char* line, const char* line_end, ImU32 flags);
+};
+
+// Helper: Batch evaluation of ImGuiTextFilter (e.g. to filter large logs once per filter change, instead of per line every frame)
+// - 'out_pass' needs to be sized by caller with ImBitVector::Create(). Returns number of lines/strings passing the filter.
+// - Both functions are const/thread-safe: you may process disjoint ranges of lines in parallel, as long as range boundaries are multiple of 32.
+IMGUI_API int ImTextFilterPassLines(const ImGuiTextFilter* filter, const char* buf, const ImGuiTextIndex* index, int line_begin, int line_end, ImBitVector* out_pass);
+IMGUI_API int ImTextFilterPassStrings(const ImGuiTextFilter* filter, const char* const* texts, int texts_count, ImBitVector* out_pass);
+
 // Helper: ImGuiStorage
 IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStoragePair* in_end, ImGuiID key);
 //-----------------------------------------------------------------------------
@@ -1224,6 +1410,7 @@ enum ImGuiNextItemDataFlags_
     ImGuiNextItemDataFlags_HasShortcut  = 1 << 2,
     ImGuiNextItemDataFlags_HasRefVal    = 1 << 3,
     ImGuiNextItemDataFlags_HasStorageID = 1 << 4,
+    ImGuiNextItemDataFlags_HasHashedLabel = 1 << 5,
 };
 
 struct ImGuiNextItemData
@@ -1240,6 +1427,7 @@ struct ImGuiNextItemData
     ImU8                        OpenCond;           // Set by SetNextItemOpen()
     ImGuiDataTypeStorage        RefVal;             // Not exposed yet, for ImGuiInputTextFlags_ParseEmptyAsRefVal
     ImGuiID                     StorageId;          // Set by SetNextItemStorageID()
+    ImGuiHashedStr              HashedLabel;        // Set by SetNextItemHashedLabel(). Used by ImGuiWindow::GetID() when passed the same string pointer.
 
     ImGuiNextItemData()         { memset(this, 0, sizeof(*this)); SelectionUserData = -1; }
     inline void ClearFlags()    { HasFlags = ImGuiNextItemDataFlags_None; ItemFlags = ImGuiItemFlags_None; } // Also cleared manually by ItemAdd()!
@@ -1300,6 +1488,16 @@ struct ImGuiWindowStackData
     bool                    DisabledOverrideReenable;   // Non-child window override disabled flag
 };
 
+// Compact copy of hit-testing data for an active window, built in EndFrame() and used by FindHoveredWindowEx().
+// This allows hover detection to skip inactive windows (e.g. closed popups and tooltips are never deleted) and
+// to avoid touching ImGuiWindow data for most windows.
+struct ImGuiWindowHitTestData
+{
+    ImRect                  Rect;                       // == window->OuterRectClipped
+    ImGuiWindow*            Window;
+    bool                    UseResizePadding;           // Window is resizable: use g.WindowsHoverPadding instead of style.TouchExtraPadding
+};
+
 struct ImGuiShrinkWidthItem
 {
     int         Index;
@@ -1416,6 +1614,8 @@ struct ImGuiInputEvent
         ImGuiInputEventAppFocused   AppFocused;     // if Type == ImGuiInputEventType_Focus
     };
     bool                            AddedByTestEngine;
+    bool                            TrailOnly;      // Raw event coalesced into the next one by the thread queue: not processed, only appended to InputEventsTrail with it.
+    bool                            NotInTrail;     // Event summed by the thread queue from previous 'TrailOnly' events: processed but not appended to InputEventsTrail.
 
     ImGuiInputEvent() { memset(this, 0, sizeof(*this)); }
 };
@@ -1956,16 +2156,79 @@ struct ImGuiDebugAllocEntry
     ImS16       FreeCount;
 };
 
+// Aggregated allocations for a given IM_ALLOC() call-site (only with IMGUI_DEBUG_ALLOC_CALLSITES)
+// Note that all ImVector<> allocations are reported at the same call-site in imgui.h, use 'LastWindowID' to narrow down the culprit.
+struct ImGuiDebugAllocCallSite
+{
+    const char* File;                       // NULL when unused. Pointer to __FILE__ string literal.
+    int         Line;
+    ImGuiID     LastWindowID;               // Current window during last allocation (0 if none)
+    int         TotalAllocCount;
+    ImU64       TotalAllocBytes;
+    int         FramesWithAllocsCount;      // Number of distinct frames with allocations from this site
+    int         LastFrame;                  // Last frame with allocations from this site
+    int         LastFrameAllocCount;        // Allocations during 'LastFrame'
+    int         LastFrameAllocBytes;
+};
+
 struct ImGuiDebugAllocInfo
 {
     int         TotalAllocCount;            // Number of call to MemAlloc().
     int         TotalFreeCount;
     ImS16       LastEntriesIdx;             // Current index in buffer
     ImGuiDebugAllocEntry LastEntriesBuf[6]; // Track last 6 frames that had allocations
+#ifdef IMGUI_DEBUG_ALLOC_CALLSITES
+    int         CallSitesCount;
+    int         CallSitesOverflowCount;     // Allocations which couldn't be recorded because CallSites[] is full
+    ImGuiDebugAllocCallSite CallSites[512]; // Open-addressing hash table. Fixed size so recording never allocates.
+#endif
 
     ImGuiDebugAllocInfo() { memset(this, 0, sizeof(*this)); }
 };
 
+// Profiler scopes (only recorded when IMGUI_ENABLE_PROFILER is defined, see 'Metrics->Profiler')
+// - Use IMGUI_PROFILER_SCOPE(name, owner_id) for a C++ scope, or IMGUI_PROFILER_BEGIN()/IMGUI_PROFILER_END() pairs with same name/owner.
+// - 'name' must be a string literal (we store the pointer). 'owner_id' is the ID of a window or table, or 0.
+#define IMGUI_PROFILER_FRAMES_COUNT     16
+
+struct ImGuiProfilerEvent
+{
+    const char*             Name;
+    ImGuiID                 OwnerID;
+    ImU64                   TimeBegin;          // In nanoseconds
+    ImU64                   TimeEnd;
+    int                     Depth;
+};
+
+struct ImGuiProfilerFrame
+{
+    int                     FrameCount;         // 0 when unused
+    ImU64                   TimeBegin;          // In nanoseconds
+    ImU64                   TimeEnd;
+    ImVector<ImGuiProfilerEvent> Events;        // Events in submission order (parents before children)
+};
+
+struct ImGuiProfiler
+{
+    bool                    Paused;             // Set to stop recording from next frame
+    bool                    Recording;          // Recording current frame (== !Paused at the time of NewFrame())
+    int                     FrameIdx;           // Index of current frame in Frames[]
+    ImGuiProfilerFrame      Frames[IMGUI_PROFILER_FRAMES_COUNT];
+    ImVector<int>           Stack;              // Indices of open events in Frames[FrameIdx].Events[]
+
+    ImGuiProfiler()         { Paused = Recording = false; FrameIdx = 0; for (ImGuiProfilerFrame& frame : Frames) { frame.FrameCount = 0; frame.TimeBegin = frame.TimeEnd = 0; } }
+};
+
+#ifdef IMGUI_ENABLE_PROFILER
+#define IMGUI_PROFILER_BEGIN(_NAME, _OWNER_ID)  ImGui::DebugProfilerBeginEvent(_NAME, _OWNER_ID)
+#define IMGUI_PROFILER_END(_NAME, _OWNER_ID)    ImGui::DebugProfilerEndEvent(_NAME, _OWNER_ID)
+#define IMGUI_PROFILER_SCOPE(_NAME, _OWNER_ID)  ImGuiProfilerScope im_profiler_scope(_NAME, _OWNER_ID)
+#else
+#define IMGUI_PROFILER_BEGIN(_NAME, _OWNER_ID)  ((void)0)
+#define IMGUI_PROFILER_END(_NAME, _OWNER_ID)    ((void)0)
+#define IMGUI_PROFILER_SCOPE(_NAME, _OWNER_ID)  ((void)0)
+#endif
+
 struct ImGuiMetricsConfig
 {
     bool        ShowDebugLog = false;
@@ -2046,6 +2309,7 @@ struct ImGuiContext
     int                     FrameCount;
     int                     FrameCountEnded;
     int                     FrameCountRendered;
+    float                   NextRefreshDelay;                   // Reset by NewFrame(), lowered by RequestRefresh(). Copied to io.NextRefreshDelay by EndFrame().
     ImGuiID                 WithinEndChildID;                   // Set within EndChild()
     bool                    WithinFrameScope;                   // Set by NewFrame(), cleared by EndFrame()
     bool                    WithinFrameScopeWithImplicitWindow; // Set by NewFrame(), cleared by EndFrame() when the implicit debug window has been pushed
@@ -2059,11 +2323,14 @@ struct ImGuiContext
     ImVector<ImGuiInputEvent> InputEventsTrail;                 // Past input events processed in NewFrame(). This is to allow domain-specific application to access e.g mouse/pen trail.
     ImGuiMouseSource        InputEventsNextMouseSource;
     ImU32                   InputEventsNextEventId;
+    ImGuiInputEventThreadQueue* InputEventsThreadQueue;         // Optional queue for events posted from other threads. See CreateInputEventThreadQueue() (only with IMGUI_ENABLE_INPUT_THREAD_QUEUE).
 
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
+    ImVector<ImGuiWindowHitTestData> WindowsHitTestData;        // Active, hoverable windows sorted in display order, back to front. Built in EndFrame().
+    bool                    WindowsHitTestDataValid;            // Cleared when display order changes after EndFrame() (e.g. focus change during NavUpdate()), FindHoveredWindowEx() then falls back to scanning all windows.
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
@@ -2363,8 +2630,10 @@ struct ImGuiContext
     // (some of the highly frequently used data are interleaved in other structures above: DebugBreakXXX fields, DebugHookIdInfo, DebugLocateId etc.)
     int                     DebugDrawIdConflictsCount;          // Locked count (preserved when holding CTRL)
     ImGuiDebugLogFlags      DebugLogFlags;
-    ImGuiTextBuffer         DebugLogBuf;
-    ImGuiTextIndex          DebugLogIndex;
+    ImGuiTextRingBuffer     DebugLogRing;                       // Debug Log lines. Grows up to a fixed capacity, then oldest lines are evicted. You may call DebugLogRing.Create() before first log to change its default capacity.
+    ImGuiTextBuffer         DebugLogLineBuf;                    // Scratch buffer to format an entry before storing it in DebugLogRing
+    ImGuiDebugLogFlags      DebugLogCurrentCategory;            // Set by IMGUI_DEBUG_LOG_XXX() macros around their call to DebugLog(), stored in each line's Flags
+    ImGuiDebugLogFlags      DebugLogViewFilter;                 // Categories displayed by ShowDebugLogWindow(). Lines without a category are always displayed.
     int                     DebugLogSkippedErrors;
     ImGuiDebugLogFlags      DebugLogAutoDisableFlags;
     ImU8                    DebugLogAutoDisableFrames;
@@ -2380,6 +2649,9 @@ struct ImGuiContext
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler           Profiler;
+#endif
 
     // Misc
     float                   FramerateSecPerFrame[60];           // Calculate estimate of framerate for user over the last 60 frames..
@@ -2390,6 +2662,8 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;
     ImVector<char>          TempBuffer;                         // Temporary text buffer
+    ImVector<float>         PlotTempBuffer;                     // Temporary buffer for PlotEx() min/max decimation
+    ImFrameArena            FrameArena;                         // Linear allocator for transient data, reset every frame. Use with ImFrameVector<>.
     char                    TempKeychordName[64];
 
     ImGuiContext(ImFontAtlas* shared_font_atlas);
@@ -2447,8 +2721,8 @@ struct IMGUI_API ImGuiWindowTempData
     // We store the current settings outside of the vectors to increase memory locality (reduce cache misses). The vectors are rarely modified. Also it allows us to not heap allocate for short-lived windows which are not using those settings.
     float                   ItemWidth;              // Current item width (>0.0: width in pixels, <0.0: align xx pixels to the right of window).
     float                   TextWrapPos;            // Current text wrap pos.
-    ImVector<float>         ItemWidthStack;         // Store item widths to restore (attention: .back() is not == ItemWidth)
-    ImVector<float>         TextWrapPosStack;       // Store text wrap pos to restore (attention: .back() is not == TextWrapPos)
+    ImSmallVector<float, 4> ItemWidthStack;         // Store item widths to restore (attention: .back() is not == ItemWidth)
+    ImSmallVector<float, 4> TextWrapPosStack;       // Store text wrap pos to restore (attention: .back() is not == TextWrapPos)
 };
 
 // Storage for one window
@@ -2566,6 +2840,7 @@ public:
     ImGuiID     GetID(const char* str, const char* str_end = NULL);
     ImGuiID     GetID(const void* ptr);
     ImGuiID     GetID(int n);
+    ImGuiID     GetID(const ImGuiHashedStr& str);
     ImGuiID     GetIDFromPos(const ImVec2& p_abs);
     ImGuiID     GetIDFromRectangle(const ImRect& r_abs);
 
@@ -2619,7 +2894,7 @@ struct ImGuiTabItem
 struct IMGUI_API ImGuiTabBar
 {
     ImGuiWindow*        Window;
-    ImVector<ImGuiTabItem> Tabs;
+    ImSmallVector<ImGuiTabItem, 4> Tabs;
     ImGuiTabBarFlags    Flags;
     ImGuiID             ID;                     // Zero for tab-bars used by docking
     ImGuiID             SelectedTabId;          // Selected tab/window
@@ -2775,6 +3050,7 @@ struct IMGUI_API ImGuiTable
     ImBitArrayPtr               EnabledMaskByDisplayOrder;  // Column DisplayOrder -> IsEnabled map
     ImBitArrayPtr               EnabledMaskByIndex;         // Column Index -> IsEnabled map (== not hidden by user/api) in a format adequate for iterating column without touching cold data
     ImBitArrayPtr               VisibleMaskByIndex;         // Column Index -> IsVisibleX|IsVisibleY map (== not hidden by user/api && not hidden by scrolling/cliprect)
+    ImBitArrayPtr               RequestOutputMaskByIndex;   // Column Index -> IsRequestOutput map (== visible or auto-fitting), used by TableNextVisibleColumn()
     ImGuiTableFlags             SettingsLoadedFlags;        // Which data were loaded from the .ini file (e.g. when order is not altered we won't save order)
     int                         SettingsOffset;             // Offset in g.SettingsTables
     int                         LastFrameActive;
@@ -2826,9 +3102,9 @@ struct IMGUI_API ImGuiTable
     ImGuiTextBuffer             ColumnsNames;               // Contiguous buffer holding columns names
     ImDrawListSplitter*         DrawSplitter;               // Shortcut to TempData->DrawSplitter while in table. Isolate draw commands per columns to avoid switching clip rect constantly
     ImGuiTableInstanceData      InstanceDataFirst;
-    ImVector<ImGuiTableInstanceData>    InstanceDataExtra;  // FIXME-OPT: Using a small-vector pattern would be good.
+    ImSmallVector<ImGuiTableInstanceData, 2> InstanceDataExtra; // Data for instances 1+ (rare)
     ImGuiTableColumnSortSpecs   SortSpecsSingle;
-    ImVector<ImGuiTableColumnSortSpecs> SortSpecsMulti;     // FIXME-OPT: Using a small-vector pattern would be good.
+    ImSmallVector<ImGuiTableColumnSortSpecs, 4> SortSpecsMulti; // Only used when SortSpecsCount > 1
     ImGuiTableSortSpecs         SortSpecs;                  // Public facing sorts specs, this is what we return in TableGetSortSpecs()
     ImGuiTableColumnIdx         SortSpecsCount;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
@@ -3183,6 +3459,19 @@ namespace ImGui
     IMGUI_API void          GetTypematicRepeatRate(ImGuiInputFlags flags, float* repeat_delay, float* repeat_rate);
     IMGUI_API void          TeleportMousePos(const ImVec2& pos);
     IMGUI_API void          SetActiveIdUsingAllKeyboardKeys();
+
+    // Inputs: Thread-safe queue (only with IMGUI_ENABLE_INPUT_THREAD_QUEUE, which includes C++11 <atomic>)
+    // - Allow platform threads (e.g. high-rate pen/mouse input thread) to post events without locking. Events are moved into g.InputEventsQueue by NewFrame().
+    // - Create the queue from main thread before starting producers, and stop producers before DestroyContext().
+    // - Events are stored as submitted: unlike io.AddXXXEvent() functions there is no duplicate filtering nor ConfigMacOSXBehaviors remapping. Don't set 'EventId'.
+    // - When 'coalesce_mouse_events' is set, consecutive MousePos events are merged into the last one, and consecutive MouseWheel events are summed.
+    //   All raw events are still appended to g.InputEventsTrail when processed, for applications wanting a full trail.
+#ifdef IMGUI_ENABLE_INPUT_THREAD_QUEUE
+    IMGUI_API void          CreateInputEventThreadQueue(ImGuiContext* ctx, int capacity, bool coalesce_mouse_events);  // Capacity is rounded up to a power of two.
+    IMGUI_API void          DestroyInputEventThreadQueue(ImGuiContext* ctx);
+    IMGUI_API bool          PostInputEventThreadSafe(ImGuiContext* ctx, const ImGuiInputEvent* e);                     // Can be called from any thread. Return false if queue is full.
+    IMGUI_API void          UpdateInputEventThreadQueue();
+#endif
     inline bool             IsActiveIdUsingNavDir(ImGuiDir dir)                         { ImGuiContext& g = *GImGui; return (g.ActiveIdUsingNavDirMask & (1 << dir)) != 0; }
 
     // [EXPERIMENTAL] Low-Level: Key/Input Ownership
@@ -3482,6 +3771,12 @@ namespace ImGui
 
     // Debug Tools
     IMGUI_API void          DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size); // size >= 0 : alloc, size = -1 : free
+    IMGUI_API void          DebugAllocHookCallSite(ImGuiDebugAllocInfo* info, int frame_count, size_t size, const char* file, int line, ImGuiID window_id);
+    IMGUI_API void          DebugAllocCallSitesReport(ImGuiDebugAllocInfo* info, ImGuiTextBuffer* out_buf);
+    IMGUI_API void          DebugProfilerNewFrame();
+    IMGUI_API void          DebugProfilerBeginEvent(const char* name, ImGuiID owner_id);
+    IMGUI_API void          DebugProfilerEndEvent(const char* name, ImGuiID owner_id);
+    IMGUI_API void          DebugProfilerExportChromeTrace(ImGuiTextBuffer* out_buf);
     IMGUI_API void          DebugDrawCursorPos(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawLineExtents(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawItemRect(ImU32 col = IM_COL32(255, 0, 0, 255));
@@ -3530,6 +3825,17 @@ namespace ImGui
 
 } // namespace ImGui
 
+#ifdef IMGUI_ENABLE_PROFILER
+// Helper: record a profiler event for the lifetime of a C++ scope. Use via IMGUI_PROFILER_SCOPE().
+struct ImGuiProfilerScope
+{
+    const char* Name;
+    ImGuiID     OwnerID;
+    ImGuiProfilerScope(const char* name, ImGuiID owner_id)  { Name = name; OwnerID = owner_id; ImGui::DebugProfilerBeginEvent(name, owner_id); }
+    ~ImGuiProfilerScope()                                   { ImGui::DebugProfilerEndEvent(Name, OwnerID); }
+};
+#endif
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] ImFontAtlas internal API
@@ -3550,12 +3856,55 @@ IMGUI_API void      ImFontAtlasUpdateConfigDataPointers(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
 IMGUI_API void      ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
+IMGUI_API void      ImFontAtlasBuildPackFontRects(ImFontAtlas* atlas, void* stbrp_context_opaque, void* stbrp_nodes_opaque, void* stbrp_rects_opaque, int rects_count);
 IMGUI_API void      ImFontAtlasBuildFinish(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
+// Shared font data (read-only TTF/OTF file contents)
+// - Created by AddFontFromFileTTF() (memory-mapped when available) and AddFontFromMemoryCompressedTTF()/AddFontFromMemoryCompressedBase85TTF() (decompressed once).
+// - Stored in a process-wide registry, so adding the same source again, at another size, merged, or into another ImFontAtlas, reuses the same data.
+// - Each ImFontConfig referring to a blob holds a reference, released by ImFontAtlas::ClearInputData(). Data is freed/unmapped with the last reference.
+// - With IMGUI_THREAD_LOCAL_CONTEXT the registry is protected by a lock: atlases used by contexts on different threads may add fonts concurrently.
+enum ImFontBlobSource
+{
+    ImFontBlobSource_File,                  // Keyed by filename
+    ImFontBlobSource_Compressed,            // Keyed by address + size of compressed data, checked with a hash of its first and last bytes
+    ImFontBlobSource_CompressedBase85,      // Keyed by address + size of Base85 string, checked with a hash of its first and last bytes
+};
+
+struct ImFontBlob
+{
+    void*               Data;               // TTF/OTF data (read-only)
+    size_t              DataSize;
+    int                 RefCount;           // Protected by registry lock
+    bool                IsMapped;           // Data is a memory-mapped file view, otherwise a heap allocation
+    ImFontBlobSource    Source;
+    const void*         SourceData;         // Address of compressed data (ImFontBlobSource_Compressed*)
+    size_t              SourceSize;         // Size of compressed data (ImFontBlobSource_Compressed*)
+    ImGuiID             SourceHash;         // Hash of first and last bytes of compressed data (ImFontBlobSource_Compressed*)
+    char*               Filename;           // (ImFontBlobSource_File)
+    ImGuiMemAllocFunc   AllocFunc;          // Allocator functions current at creation time: the blob, its Data (unless mapped) and Filename are freed with them
+    ImGuiMemFreeFunc    FreeFunc;
+    void*               AllocUserData;
+    ImFontBlob*         Next;               // Next in registry
+
+    ImFontBlob()        { memset(this, 0, sizeof(*this)); }
+};
+
+IMGUI_API ImFontBlob*   ImFontBlobCreateFromFile(const char* filename);                                     // Find or load. Return a new reference, or NULL if file cannot be loaded.
+IMGUI_API ImFontBlob*   ImFontBlobCreateFromCompressed(const void* compressed_data, size_t compressed_size, bool base85); // Find or decompress. Return a new reference.
+IMGUI_API void          ImFontBlobAddRef(ImFontBlob* blob);
+IMGUI_API void          ImFontBlobRelease(ImFontBlob* blob);
+
+// Compressed font data (see misc/fonts/binary_to_compressed_c.cpp)
+IMGUI_API size_t        ImFontDecompressGetSize(const void* compressed_data, size_t compressed_size);         // Return 0 if data is not recognized
+IMGUI_API int           ImFontDecompressGetBlockCount(const void* compressed_data, size_t compressed_size);   // Independent blocks: 1 for stb_compress() format
+IMGUI_API bool          ImFontDecompress(void* dst, size_t dst_size, const void* compressed_data, size_t compressed_size, int block_begin = 0, int block_end = -1); // Blocks may be decompressed from multiple threads
+IMGUI_API void          ImDecode85(const char* src, size_t src_len, unsigned char* dst);                        // Decode (src_len / 5) * 4 bytes
+
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
 //-----------------------------------------------------------------------------
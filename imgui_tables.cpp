@@ -176,6 +176,8 @@ Index of this file:
 //           ClipRect:    normal      zero-width   zero-width  -> [internal] when ClipRect is zero, ItemAdd() will return false and most widgets will early out mid-way.
 //  ImDrawList output:    normal      dummy        dummy       -> [internal] when using the dummy channel, ImDrawList submissions (if any) will be wasted (because cliprect is zero-width anyway).
 //
+// - TableNextVisibleColumn() only visits columns for which TableNextColumn() would return true, and doesn't perform any per-cell work for other columns.
+//   This is most useful for very wide tables (e.g. hundreds of columns with horizontal scrolling) when the tallest cells are known by the programmer.
 // - We need to distinguish those cases because non-hidden columns that are clipped outside of scrolling bounds should still contribute their height to the row.
 //   However, in the majority of cases, the contribution to row height is the same for all columns, or the tallest cells are known by the programmer.
 //-----------------------------------------------------------------------------
@@ -343,6 +345,8 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         return false;
     }
 
+    IMGUI_PROFILER_BEGIN("Table", id);
+
     // [DEBUG] Debug break requested by user
     if (g.DebugBreakInTable == id)
         IM_DEBUG_BREAK();
@@ -647,11 +651,11 @@ void ImGui::TableBeginInitMemory(ImGuiTable* table, int columns_count)
 {
     // Allocate single buffer for our arrays
     const int columns_bit_array_size = (int)ImBitArrayGetStorageSizeInBytes(columns_count);
-    ImSpanAllocator<6> span_allocator;
+    ImSpanAllocator<7> span_allocator;
     span_allocator.Reserve(0, columns_count * sizeof(ImGuiTableColumn));
     span_allocator.Reserve(1, columns_count * sizeof(ImGuiTableColumnIdx));
     span_allocator.Reserve(2, columns_count * sizeof(ImGuiTableCellData), 4);
-    for (int n = 3; n < 6; n++)
+    for (int n = 3; n < 7; n++)
         span_allocator.Reserve(n, columns_bit_array_size);
     table->RawData = IM_ALLOC(span_allocator.GetArenaSizeInBytes());
     memset(table->RawData, 0, span_allocator.GetArenaSizeInBytes());
@@ -662,6 +666,7 @@ void ImGui::TableBeginInitMemory(ImGuiTable* table, int columns_count)
     table->EnabledMaskByDisplayOrder = (ImU32*)span_allocator.GetSpanPtrBegin(3);
     table->EnabledMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(4);
     table->VisibleMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(5);
+    table->RequestOutputMaskByIndex = (ImU32*)span_allocator.GetSpanPtrBegin(6);
 }
 
 // Apply queued resizing/reordering/hiding requests
@@ -795,6 +800,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
     IM_ASSERT(table->IsLayoutLocked == false);
+    IMGUI_PROFILER_SCOPE("TableUpdateLayout", table->ID);
 
     const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
     table->IsDefaultDisplayOrder = true;
@@ -1045,6 +1051,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     ImRect host_clip_rect = table->InnerClipRect;
     //host_clip_rect.Max.x += table->CellPaddingX + table->CellSpacingX2;
     ImBitArrayClearAllBits(table->VisibleMaskByIndex, table->ColumnsCount);
+    ImBitArrayClearAllBits(table->RequestOutputMaskByIndex, table->ColumnsCount);
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
         const int column_n = table->DisplayOrderToIndex[order_n];
@@ -1115,6 +1122,8 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
 
         // Mark column as requesting output from user. Note that fixed + non-resizable sets are auto-fitting at all times and therefore always request output.
         column->IsRequestOutput = is_visible || column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0;
+        if (column->IsRequestOutput)
+            ImBitArraySetBit(table->RequestOutputMaskByIndex, column_n);
 
         // Mark column as SkipItems (ignoring all items/layout)
         // (table->HostSkipItems is a copy of inner_window->SkipItems before we cleared it above in Part 2)
@@ -1170,6 +1179,8 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         {
             column->AutoFitQueue >>= 1;
             column->CannotSkipItemsQueue >>= 1;
+            if (column->AutoFitQueue != 0x00 || column->CannotSkipItemsQueue != 0x00)
+                RequestRefresh(); // Auto-fit runs over multiple frames
         }
 
         if (visible_n < table->FreezeColumnsCount)
@@ -1185,6 +1196,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     {
         table->Columns[table->LeftMostEnabledColumn].IsRequestOutput = true;
         table->Columns[table->LeftMostEnabledColumn].IsSkipItems = false;
+        ImBitArraySetBit(table->RequestOutputMaskByIndex, table->LeftMostEnabledColumn);
     }
 
     // [Part 7] Detect/store when we are hovering the unused space after the right-most column (so e.g. context menus can react on it)
@@ -1330,6 +1342,8 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
             table->HoveredColumnBorder = (ImGuiTableColumnIdx)column_n;
             SetMouseCursor(ImGuiMouseCursor_ResizeEW);
         }
+        else if (hovered)
+            RequestRefresh(TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER - g.HoveredIdTimer);
     }
 }
 
@@ -1552,6 +1566,7 @@ void    ImGui::EndTable()
     }
     outer_window->DC.CurrentTableIdx = g.CurrentTable ? g.Tables.GetIndex(g.CurrentTable) : -1;
     NavUpdateCurrentWindowIsScrollPushableX();
+    IMGUI_PROFILER_END("Table", table->ID);
 }
 
 // See "COLUMNS SIZING POLICIES" comments at the top of this file
@@ -2060,6 +2075,7 @@ void ImGui::TableEndRow(ImGuiTable* table)
 // - TableGetColumnIndex()
 // - TableSetColumnIndex()
 // - TableNextColumn()
+// - TableNextVisibleColumn()
 // - TableBeginCell() [Internal]
 // - TableEndCell() [Internal]
 //-------------------------------------------------------------------------
@@ -2119,8 +2135,43 @@ bool ImGui::TableNextColumn()
     return table->Columns[table->CurrentColumn].IsRequestOutput;
 }
 
+// [Public] Append into the next column of current row which requests output (visible or auto-fitting), skipping other columns.
+// - Skipped columns don't run TableBeginCell()/TableEndCell() at all, which matters for very wide tables with horizontal scrolling.
+// - Does not wrap around into next row: return false once there are no more visible columns in current row.
+// - Skipped columns don't contribute to row height: if a column may have the tallest contribution to row height, use TableSetColumnIndex() for it.
+bool ImGui::TableNextVisibleColumn()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    if (!table)
+        return false;
+    if (!table->IsInsideRow)
+        TableNextRow();
+
+    // Scan bit array 32 columns at a time
+    const ImU32* mask = table->RequestOutputMaskByIndex;
+    int column_n = table->CurrentColumn + 1;
+    while (column_n < table->ColumnsCount)
+    {
+        if ((column_n & 31) == 0 && mask[column_n >> 5] == 0)
+        {
+            column_n += 32;
+            continue;
+        }
+        if (IM_BITARRAY_TESTBIT(mask, column_n))
+            break;
+        column_n++;
+    }
+    if (column_n >= table->ColumnsCount)
+        return false;
+
+    if (table->CurrentColumn != -1)
+        TableEndCell(table);
+    TableBeginCell(table, column_n);
+    return true;
+}
 
-// [Internal] Called by TableSetColumnIndex()/TableNextColumn()
+// [Internal] Called by TableSetColumnIndex()/TableNextColumn()/TableNextVisibleColumn()
 // This is called very frequently, so we need to be mindful of unnecessary overhead.
 // FIXME-TABLE FIXME-OPT: Could probably shortcut some things for non-active or clipped columns.
 void ImGui::TableBeginCell(ImGuiTable* table, int column_n)
@@ -2965,7 +3016,7 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
 
     // Write output
     // May be able to move all SortSpecs data from table (48 bytes) to ImGuiTableTempData if we decide to write it back on every BeginTable()
-    ImGuiTableColumnSortSpecs* sort_specs = (table->SortSpecsCount == 0) ? NULL : (table->SortSpecsCount == 1) ? &table->SortSpecsSingle : table->SortSpecsMulti.Data;
+    ImGuiTableColumnSortSpecs* sort_specs = (table->SortSpecsCount == 0) ? NULL : (table->SortSpecsCount == 1) ? &table->SortSpecsSingle : table->SortSpecsMulti.data();
     if (dirty && sort_specs != NULL)
         for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
         {
@@ -1346,6 +1346,8 @@ void ImGui::ProgressBar(float fraction, const ImVec2& size_arg, const char* over
     const bool is_indeterminate = (fraction < 0.0f);
     if (!is_indeterminate)
         fraction = ImSaturate(fraction);
+    else
+        RequestRefresh();
 
     // Out of courtesy we accept a NaN fraction without crashing
     float fill_n0 = 0.0f;
@@ -1716,6 +1718,8 @@ bool ImGui::SplitterBehavior(const ImRect& bb, ImGuiID id, ImGuiAxis axis, float
 
     if (held || (hovered && g.HoveredIdPreviousFrame == id && g.HoveredIdTimer >= hover_visibility_delay))
         SetMouseCursor(axis == ImGuiAxis_Y ? ImGuiMouseCursor_ResizeNS : ImGuiMouseCursor_ResizeEW);
+    else if (hovered)
+        RequestRefresh(hover_visibility_delay - g.HoveredIdTimer);
 
     ImRect bb_render = bb;
     if (held)
@@ -3916,7 +3920,7 @@ static ImVec2 InputTextCalcTextSize(ImGuiContext* ctx, const char* text_begin, c
         if (c == '\r')
             continue;
 
-        const float char_width = ((int)c < font->IndexAdvanceX.Size ? font->IndexAdvanceX.Data[c] : font->FallbackAdvanceX) * scale;
+        const float char_width = ((int)c < font->IndexAdvanceX.Size ? font->IndexAdvanceX.Data[c] : font->GetCharAdvance((ImWchar)c)) * scale;
         line_width += char_width;
     }
 
@@ -4663,7 +4667,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         password_font->ContainerAtlas = g.Font->ContainerAtlas;
         password_font->FallbackGlyph = glyph;
         password_font->FallbackAdvanceX = glyph->AdvanceX;
-        IM_ASSERT(password_font->Glyphs.empty() && password_font->IndexAdvanceX.empty() && password_font->IndexLookup.empty());
+        IM_ASSERT(password_font->Glyphs.empty() && password_font->IndexAdvanceX.empty() && password_font->IndexLookup.empty() && password_font->IndexPageMap.empty());
         PushFont(password_font);
     }
 
@@ -4918,7 +4922,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 // Filter pasted buffer
                 const int clipboard_len = (int)strlen(clipboard);
-                ImVector<char> clipboard_filtered;
+                ImFrameVector<char> clipboard_filtered(&g.FrameArena);
                 clipboard_filtered.reserve(clipboard_len + 1);
                 for (const char* s = clipboard; *s != 0; )
                 {
@@ -5289,6 +5293,11 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             state->CursorAnim += io.DeltaTime;
             bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (state->CursorAnim <= 0.0f) || ImFmod(state->CursorAnim, 1.20f) <= 0.80f;
+            if (g.IO.ConfigInputTextCursorBlink)
+            {
+                const float blink_t = ImFmod(state->CursorAnim, 1.20f);
+                RequestRefresh((state->CursorAnim <= 0.0f) ? -state->CursorAnim : (blink_t <= 0.80f) ? (0.80f - blink_t) : (1.20f - blink_t));
+            }
             ImVec2 cursor_screen_pos = ImTrunc(draw_pos + cursor_offset - draw_scroll);
             ImRect cursor_screen_rect(cursor_screen_pos.x, cursor_screen_pos.y - g.FontSize + 0.5f, cursor_screen_pos.x + 1.0f, cursor_screen_pos.y - 1.5f);
             if (cursor_is_visible && cursor_screen_rect.Overlaps(clip_rect))
@@ -6056,9 +6065,21 @@ bool ImGui::ColorPicker4(const char* label, float col[4], ImGuiColorEditFlags fl
         sv_cursor_pos.x = ImClamp(IM_ROUND(picker_pos.x + ImSaturate(S)     * sv_picker_size), picker_pos.x + 2, picker_pos.x + sv_picker_size - 2); // Sneakily prevent the circle to stick out too much
         sv_cursor_pos.y = ImClamp(IM_ROUND(picker_pos.y + ImSaturate(1 - V) * sv_picker_size), picker_pos.y + 2, picker_pos.y + sv_picker_size - 2);
 
-        // Render Hue Bar
-        for (int i = 0; i < 6; ++i)
-            draw_list->AddRectFilledMultiColor(ImVec2(bar0_pos_x, picker_pos.y + i * (sv_picker_size / 6)), ImVec2(bar0_pos_x + bars_width, picker_pos.y + (i + 1) * (sv_picker_size / 6)), col_hues[i], col_hues[i], col_hues[i + 1], col_hues[i + 1]);
+        // Render Hue Bar (as a single strip of 6 quads sharing their edges)
+        ImVec2 uv_white = GetFontTexUvWhitePixel();
+        draw_list->PrimReserve(6 * 6, (6 + 1) * 2);
+        ImDrawIdx idx = (ImDrawIdx)draw_list->_VtxCurrentIdx;
+        for (int i = 0; i < 6 + 1; ++i)
+        {
+            const float y = picker_pos.y + i * (sv_picker_size / 6);
+            draw_list->PrimWriteVtx(ImVec2(bar0_pos_x, y), uv_white, col_hues[i]);
+            draw_list->PrimWriteVtx(ImVec2(bar0_pos_x + bars_width, y), uv_white, col_hues[i]);
+        }
+        for (int i = 0; i < 6; ++i, idx += 2)
+        {
+            draw_list->PrimWriteIdx(idx); draw_list->PrimWriteIdx((ImDrawIdx)(idx + 1)); draw_list->PrimWriteIdx((ImDrawIdx)(idx + 3));
+            draw_list->PrimWriteIdx(idx); draw_list->PrimWriteIdx((ImDrawIdx)(idx + 3)); draw_list->PrimWriteIdx((ImDrawIdx)(idx + 2));
+        }
         float bar0_line_y = IM_ROUND(picker_pos.y + H * sv_picker_size);
         RenderFrameBorder(ImVec2(bar0_pos_x, picker_pos.y), ImVec2(bar0_pos_x + bars_width, picker_pos.y + sv_picker_size), 0.0f);
         RenderArrowsForVerticalBar(draw_list, ImVec2(bar0_pos_x - 1, bar0_line_y), ImVec2(bars_triangles_half_sz + 1, bars_triangles_half_sz), bars_width + 2.0f, style.Alpha);
@@ -8041,6 +8062,7 @@ void ImGui::DebugNodeMultiSelectState(ImGuiMultiSelectState* storage)
 //-------------------------------------------------------------------------
 // - ImGuiSelectionBasicStorage
 // - ImGuiSelectionExternalStorage
+// - ImGuiSelectionRangeStorage
 //-------------------------------------------------------------------------
 
 ImGuiSelectionBasicStorage::ImGuiSelectionBasicStorage()
@@ -8228,6 +8250,169 @@ void ImGuiSelectionExternalStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
     }
 }
 
+//-------------------------------------------------------------------------
+
+ImGuiSelectionRangeStorage::ImGuiSelectionRangeStorage()
+{
+    Size = 0;
+}
+
+void ImGuiSelectionRangeStorage::Clear()
+{
+    Size = 0;
+    _Ranges.resize(0);
+}
+
+void ImGuiSelectionRangeStorage::Swap(ImGuiSelectionRangeStorage& r)
+{
+    ImSwap(Size, r.Size);
+    _Ranges.swap(r._Ranges);
+}
+
+// Return index of first range with Max >= idx (or _Ranges.Size)
+static int ImGuiSelectionRangeStorage_LowerBound(const ImVector<ImGuiSelectionRangeStorage::ImGuiSelectionRange>& ranges, int idx)
+{
+    int first = 0;
+    int count = ranges.Size;
+    while (count > 0)
+    {
+        int count2 = count >> 1;
+        int mid = first + count2;
+        if (ranges.Data[mid].Max < idx)
+        {
+            first = mid + 1;
+            count -= count2 + 1;
+        }
+        else
+        {
+            count = count2;
+        }
+    }
+    return first;
+}
+
+bool ImGuiSelectionRangeStorage::Contains(int idx) const
+{
+    const int n = ImGuiSelectionRangeStorage_LowerBound(_Ranges, idx);
+    return n < _Ranges.Size && _Ranges.Data[n].Min <= idx;
+}
+
+void ImGuiSelectionRangeStorage::SetItemSelected(int idx, bool selected)
+{
+    SetRangeSelected(idx, idx, selected);
+}
+
+// Replace all ranges overlapping [idx_first..idx_last] (and adjacent ones when selecting) in a single pass.
+// Cost is a binary search + one memmove of the ranges vector, independent of the number of items in the range.
+void ImGuiSelectionRangeStorage::SetRangeSelected(int idx_first, int idx_last, bool selected)
+{
+    if (idx_first > idx_last)
+        ImSwap(idx_first, idx_last);
+    IM_ASSERT(idx_first >= 0);
+
+    // Find [n_begin, n_end) ranges touched by the request.
+    // When selecting, we also merge with ranges directly adjacent to the request to keep the set canonical.
+    const int touch_first = selected && idx_first > 0 ? idx_first - 1 : idx_first;
+    const int touch_last = selected && idx_last < INT_MAX ? idx_last + 1 : idx_last;
+    const int n_begin = ImGuiSelectionRangeStorage_LowerBound(_Ranges, touch_first);
+    int n_end = n_begin;
+    int removed_count = 0;
+    while (n_end < _Ranges.Size && _Ranges.Data[n_end].Min <= touch_last)
+    {
+        removed_count += _Ranges.Data[n_end].Max - _Ranges.Data[n_end].Min + 1;
+        n_end++;
+    }
+    if (!selected && n_begin == n_end)
+        return;
+
+    // Build up to two replacement ranges
+    ImGuiSelectionRange new_ranges[2];
+    int new_ranges_count = 0;
+    if (selected)
+    {
+        ImGuiSelectionRange r = { idx_first, idx_last };
+        if (n_begin < n_end)
+        {
+            r.Min = ImMin(r.Min, _Ranges.Data[n_begin].Min);
+            r.Max = ImMax(r.Max, _Ranges.Data[n_end - 1].Max);
+        }
+        new_ranges[new_ranges_count++] = r;
+    }
+    else
+    {
+        if (_Ranges.Data[n_begin].Min < idx_first)
+            new_ranges[new_ranges_count++] = { _Ranges.Data[n_begin].Min, idx_first - 1 };
+        if (_Ranges.Data[n_end - 1].Max > idx_last)
+            new_ranges[new_ranges_count++] = { idx_last + 1, _Ranges.Data[n_end - 1].Max };
+    }
+
+    // Splice into vector
+    const int old_ranges_count = n_end - n_begin;
+    if (new_ranges_count > old_ranges_count)
+    {
+        _Ranges.insert(_Ranges.Data + n_end, new_ranges[0]); // Value is overwritten below
+        n_end++;
+    }
+    else if (new_ranges_count < old_ranges_count)
+    {
+        _Ranges.erase(_Ranges.Data + n_begin + new_ranges_count, _Ranges.Data + n_end);
+    }
+    for (int n = 0; n < new_ranges_count; n++)
+    {
+        _Ranges.Data[n_begin + n] = new_ranges[n];
+        removed_count -= new_ranges[n].Max - new_ranges[n].Min + 1;
+    }
+    Size -= removed_count;
+}
+
+// Iterator value stores 'next index to visit + 1' so that NULL means "start".
+bool ImGuiSelectionRangeStorage::GetNextSelectedItem(void** opaque_it, int* out_idx)
+{
+    const int idx = (int)(intptr_t)*opaque_it;
+    const int n = ImGuiSelectionRangeStorage_LowerBound(_Ranges, idx);
+    if (n >= _Ranges.Size)
+        return false;
+    const int out = ImMax(idx, _Ranges.Data[n].Min);
+    *out_idx = out;
+    *opaque_it = (void*)(intptr_t)(out + 1);
+    return true;
+}
+
+// Iterator value stores 'next range to visit'
+bool ImGuiSelectionRangeStorage::GetNextSelectedRange(void** opaque_it, int* out_first, int* out_last)
+{
+    const int n = (int)(intptr_t)*opaque_it;
+    IM_ASSERT(n >= 0 && n <= _Ranges.Size);
+    if (n >= _Ranges.Size)
+        return false;
+    *out_first = _Ranges.Data[n].Min;
+    *out_last = _Ranges.Data[n].Max;
+    *opaque_it = (void*)(intptr_t)(n + 1);
+    return true;
+}
+
+// Apply requests coming from BeginMultiSelect() and EndMultiSelect().
+// Contrary to ImGuiSelectionBasicStorage::ApplyRequests(), each request costs O(ranges) instead of O(items in request), which
+// matters for the worst case scenario of using BoxSelect2d in a grid, box-select scrolling down while wiggling left and right,
+// emitting many SetRange requests every frame.
+void ImGuiSelectionRangeStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
+{
+    IM_ASSERT(ms_io->ItemsCount != -1 && "Missing value for items_count in BeginMultiSelect() call!");
+    for (ImGuiSelectionRequest& req : ms_io->Requests)
+    {
+        if (req.Type == ImGuiSelectionRequestType_SetAll)
+        {
+            Clear();
+            if (req.Selected && ms_io->ItemsCount > 0)
+                SetRangeSelected(0, ms_io->ItemsCount - 1, true);
+        }
+        else if (req.Type == ImGuiSelectionRequestType_SetRange)
+        {
+            SetRangeSelected((int)req.RangeFirstItem, (int)req.RangeLastItem, req.Selected);
+        }
+    }
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ListBox
 //-------------------------------------------------------------------------
@@ -8359,6 +8544,86 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - others https://github.com/ocornut/imgui/wiki/Useful-Extensions
 //-------------------------------------------------------------------------
 
+struct ImGuiPlotArrayGetterData
+{
+    const float* Values;
+    int Stride;
+
+    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
+};
+
+static float Plot_ArrayGetter(void* data, int idx)
+{
+    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
+    return v;
+}
+
+// Calculate min/max of values in [idx_begin, idx_end), ignoring NaN values. Leave outputs untouched if no valid values.
+// When values are a contiguous float array (PlotLines()/PlotHistogram() with default stride), we iterate the array directly.
+static void PlotCalcValuesMinMax(float (*values_getter)(void* data, int idx), void* data, int idx_begin, int idx_end, float* p_min, float* p_max)
+{
+    float v_min = *p_min;
+    float v_max = *p_max;
+    int idx = idx_begin;
+    if (values_getter == &Plot_ArrayGetter && ((ImGuiPlotArrayGetterData*)data)->Stride == (int)sizeof(float))
+    {
+        const float* values = ((ImGuiPlotArrayGetterData*)data)->Values;
+#ifdef IMGUI_ENABLE_SSE
+        // _mm_min_ps()/_mm_max_ps() return their second operand when either is NaN, so NaN values are ignored.
+        if (idx_end - idx >= 8)
+        {
+            __m128 v_min4 = _mm_set1_ps(v_min);
+            __m128 v_max4 = _mm_set1_ps(v_max);
+            for (; idx + 4 <= idx_end; idx += 4)
+            {
+                const __m128 v4 = _mm_loadu_ps(values + idx);
+                v_min4 = _mm_min_ps(v4, v_min4);
+                v_max4 = _mm_max_ps(v4, v_max4);
+            }
+            v_min4 = _mm_min_ps(v_min4, _mm_shuffle_ps(v_min4, v_min4, _MM_SHUFFLE(2, 3, 0, 1)));
+            v_min4 = _mm_min_ps(v_min4, _mm_shuffle_ps(v_min4, v_min4, _MM_SHUFFLE(1, 0, 3, 2)));
+            v_max4 = _mm_max_ps(v_max4, _mm_shuffle_ps(v_max4, v_max4, _MM_SHUFFLE(2, 3, 0, 1)));
+            v_max4 = _mm_max_ps(v_max4, _mm_shuffle_ps(v_max4, v_max4, _MM_SHUFFLE(1, 0, 3, 2)));
+            v_min = _mm_cvtss_f32(v_min4);
+            v_max = _mm_cvtss_f32(v_max4);
+        }
+#endif
+        for (; idx < idx_end; idx++)
+        {
+            const float v = values[idx];
+            if (v != v) // Ignore NaN values
+                continue;
+            v_min = ImMin(v_min, v);
+            v_max = ImMax(v_max, v);
+        }
+    }
+    else
+    {
+        for (; idx < idx_end; idx++)
+        {
+            const float v = values_getter(data, idx);
+            if (v != v) // Ignore NaN values
+                continue;
+            v_min = ImMin(v_min, v);
+            v_max = ImMax(v_max, v);
+        }
+    }
+    *p_min = v_min;
+    *p_max = v_max;
+}
+
+// Same as PlotCalcValuesMinMax() for logical indices [n_begin, n_end) which are offset by 'values_offset' in a ring buffer.
+static void PlotCalcValuesMinMaxWrapped(float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, int n_begin, int n_end, float* p_min, float* p_max)
+{
+    int idx_begin = (n_begin + values_offset) % values_count;
+    int count = n_end - n_begin;
+    int count_before_wrap = ImMin(count, values_count - idx_begin);
+    PlotCalcValuesMinMax(values_getter, data, idx_begin, idx_begin + count_before_wrap, p_min, p_max);
+    if (count_before_wrap < count)
+        PlotCalcValuesMinMax(values_getter, data, 0, count - count_before_wrap, p_min, p_max);
+}
+
 int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
 {
     ImGuiContext& g = *GImGui;
@@ -8381,19 +8646,41 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     bool hovered;
     ButtonBehavior(frame_bb, id, &hovered, NULL);
 
+    // When there are multiple values per pixel column, we draw min/max of each column instead of point-sampling.
+    // This preserves spikes, and when the scale is not specified we derive it from columns min/max in the same pass.
+    // Each column stores 4 values: min, max, first, last.
+    const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
+    const int columns_count = ImMax((int)inner_bb.GetWidth(), 1);
+    const bool use_min_max = (values_count >= columns_count * 2);
+    if (use_min_max)
+    {
+        g.PlotTempBuffer.resize(columns_count * 4);
+        float* columns_data = g.PlotTempBuffer.Data;
+        for (int n = 0; n < columns_count; n++, columns_data += 4)
+        {
+            const int n_begin = (int)((ImS64)values_count * n / columns_count);
+            const int n_end = (int)((ImS64)values_count * (n + 1) / columns_count);
+            columns_data[0] = FLT_MAX;
+            columns_data[1] = -FLT_MAX;
+            PlotCalcValuesMinMaxWrapped(values_getter, data, values_count, values_offset, n_begin, n_end, &columns_data[0], &columns_data[1]);
+            columns_data[2] = values_getter(data, (n_begin + values_offset) % values_count);
+            columns_data[3] = values_getter(data, (n_end - 1 + values_offset) % values_count);
+        }
+    }
+
     // Determine scale from values if not specified
     if (scale_min == FLT_MAX || scale_max == FLT_MAX)
     {
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
-        {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
-        }
+        if (use_min_max)
+            for (int n = 0; n < columns_count; n++)
+            {
+                v_min = ImMin(v_min, g.PlotTempBuffer.Data[n * 4 + 0]);
+                v_max = ImMax(v_max, g.PlotTempBuffer.Data[n * 4 + 1]);
+            }
+        else
+            PlotCalcValuesMinMax(values_getter, data, 0, values_count, &v_min, &v_max);
         if (scale_min == FLT_MAX)
             scale_min = v_min;
         if (scale_max == FLT_MAX)
@@ -8402,7 +8689,6 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
 
     RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
 
-    const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
     int idx_hovered = -1;
     if (values_count >= values_count_min)
     {
@@ -8436,6 +8722,43 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
         const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
 
+        if (use_min_max)
+        {
+            // Min/max mode: one vertical span per pixel column + connect last value of previous column to first value of current column.
+            const float column_w = (inner_bb.Max.x - inner_bb.Min.x) / (float)columns_count;
+            const float* columns_data = g.PlotTempBuffer.Data;
+            const int column_hovered = (idx_hovered != -1) ? (int)((ImS64)idx_hovered * columns_count / values_count) : -1;
+            for (int n = 0; n < columns_count; n++, columns_data += 4)
+            {
+                const float v_min = columns_data[0];
+                const float v_max = columns_data[1];
+                if (v_min > v_max) // Only NaN values
+                    continue;
+                const ImU32 col = (n == column_hovered) ? col_hovered : col_base;
+                const float x0 = inner_bb.Min.x + column_w * n;
+                const float y_min = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_min - scale_min) * inv_scale));
+                const float y_max = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_max - scale_min) * inv_scale));
+                if (plot_type == ImGuiPlotType_Lines)
+                {
+                    const float x1 = x0 + column_w;
+                    const float v_prev_last = (n > 0) ? columns_data[-1] : columns_data[2];
+                    const float v_first = columns_data[2];
+                    if (v_prev_last == v_prev_last && v_first == v_first)
+                        window->DrawList->AddLine(ImVec2(x0, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_prev_last - scale_min) * inv_scale))), ImVec2(x1, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_first - scale_min) * inv_scale))), col);
+                    if (y_min != y_max)
+                        window->DrawList->AddLine(ImVec2(x1, y_min), ImVec2(x1, y_max), col);
+                }
+                else if (plot_type == ImGuiPlotType_Histogram)
+                {
+                    // Bar spans from zero line to the furthest value
+                    const float y_zero = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+                    const float x1 = (column_w >= 2.0f) ? x0 + column_w - 1.0f : x0 + column_w;
+                    window->DrawList->AddRectFilled(ImVec2(x0, ImMin(y_max, y_zero)), ImVec2(x1, ImMax(y_min, y_zero)), col);
+                }
+            }
+            res_w = 0; // Skip regular rendering loop
+        }
+
         for (int n = 0; n < res_w; n++)
         {
             const float t1 = t0 + t_step;
@@ -8475,21 +8798,6 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     return idx_hovered;
 }
 
-struct ImGuiPlotArrayGetterData
-{
-    const float* Values;
-    int Stride;
-
-    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
-};
-
-static float Plot_ArrayGetter(void* data, int idx)
-{
-    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
-    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
-    return v;
-}
-
 void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
     ImGuiPlotArrayGetterData data(values, stride);
@@ -8922,6 +9230,8 @@ bool ImGui::BeginMenuEx(const char* label, const char* icon, bool enabled)
             want_open = true;
         else if (!menu_is_open && hovered && g.HoveredIdTimer >= 0.30f && g.MouseStationaryTimer >= 0.30f) // Hover to open (timer fallback)
             want_open = true;
+        else if (!menu_is_open && hovered)
+            RequestRefresh(0.30f - ImMin(g.HoveredIdTimer, g.MouseStationaryTimer));
         if (g.NavId == id && g.NavMoveDir == ImGuiDir_Right) // Nav-Right to open
         {
             want_open = want_open_nav_init = true;
@@ -9249,7 +9559,7 @@ bool    ImGui::BeginTabBarEx(ImGuiTabBar* tab_bar, const ImRect& tab_bar_bb, ImG
 
     // Ensure correct ordering when toggling ImGuiTabBarFlags_Reorderable flag, or when a new tab was added while being not reorderable
     if ((flags & ImGuiTabBarFlags_Reorderable) != (tab_bar->Flags & ImGuiTabBarFlags_Reorderable) || (tab_bar->TabsAddedNew && !(flags & ImGuiTabBarFlags_Reorderable)))
-        ImQsort(tab_bar->Tabs.Data, tab_bar->Tabs.Size, sizeof(ImGuiTabItem), TabItemComparerByBeginOrder);
+        ImQsort(tab_bar->Tabs.data(), tab_bar->Tabs.Size, sizeof(ImGuiTabItem), TabItemComparerByBeginOrder);
     tab_bar->TabsAddedNew = false;
 
     // Flags
@@ -9301,6 +9611,10 @@ void    ImGui::EndTabBar()
     if (tab_bar->WantLayout)
         TabBarLayout(tab_bar);
 
+    // Selection and reordering requests are applied by next frame's layout
+    if (tab_bar->NextSelectedTabId != 0 || tab_bar->ReorderRequestTabId != 0)
+        RequestRefresh();
+
     // Restore the last visible height if no tab is visible, this reduce vertical flicker/movement when a tabs gets removed without calling SetTabItemClosed().
     const bool tab_bar_appearing = (tab_bar->PrevFrameVisible + 1 < g.FrameCount);
     if (tab_bar->VisibleTabWasSubmitted || tab_bar->VisibleTabId == 0 || tab_bar_appearing)
@@ -9377,7 +9691,7 @@ static void ImGui::TabBarLayout(ImGuiTabBar* tab_bar)
         tab_bar->Tabs.resize(tab_dst_n);
 
     if (need_sort_by_section)
-        ImQsort(tab_bar->Tabs.Data, tab_bar->Tabs.Size, sizeof(ImGuiTabItem), TabItemComparerBySection);
+        ImQsort(tab_bar->Tabs.data(), tab_bar->Tabs.Size, sizeof(ImGuiTabItem), TabItemComparerBySection);
 
     // Calculate spacing between sections
     sections[0].Spacing = sections[0].TabCount > 0 && (sections[1].TabCount + sections[2].TabCount) > 0 ? g.Style.ItemInnerSpacing.x : 0.0f;
@@ -9558,6 +9872,8 @@ static void ImGui::TabBarLayout(ImGuiTabBar* tab_bar)
         tab_bar->ScrollingSpeed = ImMax(tab_bar->ScrollingSpeed, ImFabs(tab_bar->ScrollingTarget - tab_bar->ScrollingAnim) / 0.3f);
         const bool teleport = (tab_bar->PrevFrameVisible + 1 < g.FrameCount) || (tab_bar->ScrollingTargetDistToVisibility > 10.0f * g.FontSize);
         tab_bar->ScrollingAnim = teleport ? tab_bar->ScrollingTarget : ImLinearSweep(tab_bar->ScrollingAnim, tab_bar->ScrollingTarget, g.IO.DeltaTime * tab_bar->ScrollingSpeed);
+        if (tab_bar->ScrollingAnim != tab_bar->ScrollingTarget)
+            RequestRefresh(); // Animated: keep refreshing until target is reached
     }
     else
     {
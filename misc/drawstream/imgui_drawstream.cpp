@@ -0,0 +1,689 @@
+// dear imgui: compact binary stream of ImDrawData, with inter-frame delta compression
+// (code)
+
+// See imgui_drawstream.h for usage and a description of the stream format.
+
+// CHANGELOG
+// (minor and older changes stripped away, please see git history for details)
+//  2026/10/18: initial version.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_drawstream.h"
+#include "imgui_internal.h"     // ImHashStr, ImHashData, ImClamp
+#include <string.h>             // memcpy, memcmp
+#include <stdint.h>             // intptr_t
+#include <math.h>               // floor
+
+// Bump when the stream format changes. Decoder rejects other versions.
+#define IM_DRAWSTREAM_VERSION       1
+
+enum ImDrawStreamFrameFlags_
+{
+    ImDrawStreamFrameFlags_Keyframe         = 1 << 0,   // Decoder forgets all previous state before decoding this frame
+};
+
+enum ImDrawStreamListMode_
+{
+    ImDrawStreamListMode_Unchanged          = 0,
+    ImDrawStreamListMode_Delta              = 1,
+    ImDrawStreamListMode_Full               = 2,
+};
+
+enum ImDrawStreamCmdFlags_
+{
+    ImDrawStreamCmdFlags_ClipRect           = 1 << 0,   // Clip rectangle differs from previous command
+    ImDrawStreamCmdFlags_TextureId          = 1 << 1,   // Texture differs from previous command
+    ImDrawStreamCmdFlags_VtxOffset          = 1 << 2,   // VtxOffset differs from previous command
+    ImDrawStreamCmdFlags_IdxOffset          = 1 << 3,   // IdxOffset is not contiguous with previous command
+    ImDrawStreamCmdFlags_ResetRenderState   = 1 << 4,   // UserCallback == ImDrawCallback_ResetRenderState
+};
+
+// Worst case encoded sizes, used to reserve output buffers once and write without bounds checks
+#define IM_DRAWSTREAM_VARINT_MAX            10
+#define IM_DRAWSTREAM_FRAME_HEADER_MAX      (1 + IM_DRAWSTREAM_VARINT_MAX * 2 + 4 * 6)
+#define IM_DRAWSTREAM_LIST_HEADER_MAX       (IM_DRAWSTREAM_VARINT_MAX + 1 + IM_DRAWSTREAM_VARINT_MAX * 3)
+#define IM_DRAWSTREAM_PAYLOAD_HEADER_MAX    (2 + IM_DRAWSTREAM_VARINT_MAX * 4)
+#define IM_DRAWSTREAM_CMD_MAX               (IM_DRAWSTREAM_VARINT_MAX * 8)
+#define IM_DRAWSTREAM_VTX_MAX               (IM_DRAWSTREAM_VARINT_MAX * 5)
+#define IM_DRAWSTREAM_QUANTIZE_MAX          ((double)((ImS64)1 << 40))
+
+//-------------------------------------------------------------------------
+// [SECTION] Helpers
+//-------------------------------------------------------------------------
+
+static inline unsigned char* ImDrawStreamWriteU64(unsigned char* p, ImU64 v)
+{
+    while (v >= 0x80)
+    {
+        *p++ = (unsigned char)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (unsigned char)v;
+    return p;
+}
+
+static inline unsigned char* ImDrawStreamWriteS64(unsigned char* p, ImS64 v)
+{
+    return ImDrawStreamWriteU64(p, ((ImU64)v << 1) ^ (ImU64)(v >> 63));
+}
+
+static inline unsigned char* ImDrawStreamWriteU32LE(unsigned char* p, ImU32 v)
+{
+    p[0] = (unsigned char)(v); p[1] = (unsigned char)(v >> 8); p[2] = (unsigned char)(v >> 16); p[3] = (unsigned char)(v >> 24);
+    return p + 4;
+}
+
+static inline unsigned char* ImDrawStreamWriteF32(unsigned char* p, float v)
+{
+    ImU32 u;
+    memcpy(&u, &v, 4);
+    return ImDrawStreamWriteU32LE(p, u);
+}
+
+static inline ImS64 ImDrawStreamQuantize(float v, double scale)
+{
+    double q = (double)v * scale;
+    if (!(q == q))
+        return 0; // NaN
+    q = ImClamp(q, -IM_DRAWSTREAM_QUANTIZE_MAX, IM_DRAWSTREAM_QUANTIZE_MAX);
+    return (ImS64)floor(q + 0.5);
+}
+
+struct ImDrawStreamReader
+{
+    const unsigned char*    P;
+    const unsigned char*    End;
+    bool                    Error;
+
+    ImDrawStreamReader(const void* data, size_t size) { P = (const unsigned char*)data; End = P + size; Error = false; }
+    size_t  Remaining() const { return (size_t)(End - P); }
+
+    ImU64 ReadU64()
+    {
+        ImU64 v = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (P >= End)
+                break;
+            const unsigned char b = *P++;
+            v |= (ImU64)(b & 0x7F) << shift;
+            if ((b & 0x80) == 0)
+                return v;
+        }
+        Error = true;
+        return 0;
+    }
+    ImS64 ReadS64()
+    {
+        const ImU64 v = ReadU64();
+        return (ImS64)(v >> 1) ^ -(ImS64)(v & 1);
+    }
+    unsigned char ReadU8()
+    {
+        if (P >= End) { Error = true; return 0; }
+        return *P++;
+    }
+    ImU32 ReadU32LE()
+    {
+        if (Remaining() < 4) { Error = true; P = End; return 0; }
+        const ImU32 v = (ImU32)P[0] | ((ImU32)P[1] << 8) | ((ImU32)P[2] << 16) | ((ImU32)P[3] << 24);
+        P += 4;
+        return v;
+    }
+    float ReadF32()
+    {
+        const ImU32 u = ReadU32LE();
+        float v;
+        memcpy(&v, &u, 4);
+        return v;
+    }
+    // Read a count, which cannot be larger than what the remaining bytes could possibly encode (protects against huge allocations on malformed data)
+    int ReadCount(size_t min_bytes_per_item)
+    {
+        const ImU64 v = ReadU64();
+        if (v > (ImU64)(Remaining() / min_bytes_per_item) || v > (ImU64)INT_MAX)
+        {
+            Error = true;
+            return 0;
+        }
+        return (int)v;
+    }
+    const unsigned char* ReadBytes(size_t size)
+    {
+        if (Remaining() < size) { Error = true; P = End; return NULL; }
+        const unsigned char* p = P;
+        P += size;
+        return p;
+    }
+};
+
+static ImDrawStreamListState* ImDrawStreamFindListState(ImVector<ImDrawStreamListState*>& lists, ImU32 key, int hint_idx)
+{
+    if (hint_idx < lists.Size && lists[hint_idx]->Key == key)
+        return lists[hint_idx];
+    for (ImDrawStreamListState* state : lists)
+        if (state->Key == key)
+            return state;
+    return NULL;
+}
+
+// Forget lists which weren't part of current frame
+static void ImDrawStreamRemoveStaleLists(ImVector<ImDrawStreamListState*>& lists, int frame_count)
+{
+    for (int n = 0; n < lists.Size; n++)
+        if (lists[n]->LastFrame != frame_count)
+        {
+            if (lists[n]->DrawList)
+                IM_DELETE(lists[n]->DrawList);
+            IM_DELETE(lists[n]);
+            lists.erase(lists.Data + n);
+            n--;
+        }
+}
+
+static void ImDrawStreamClearLists(ImVector<ImDrawStreamListState*>& lists)
+{
+    for (ImDrawStreamListState* state : lists)
+    {
+        if (state->DrawList)
+            IM_DELETE(state->DrawList);
+        IM_DELETE(state);
+    }
+    lists.clear();
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] ImDrawStreamEncoder
+//-------------------------------------------------------------------------
+
+ImDrawStreamEncoder::ImDrawStreamEncoder()
+{
+    PosFracBits = 4;
+    UvFracBits = 16;
+    StatsBytes = StatsRawBytes = 0;
+    StatsListsUnchanged = StatsListsDelta = StatsListsFull = 0;
+    FrameCount = 0;
+    NextFrameIsKeyframe = true;
+}
+
+ImDrawStreamEncoder::~ImDrawStreamEncoder()
+{
+    ImDrawStreamClearLists(Lists);
+}
+
+void ImDrawStreamEncoder::Reset()
+{
+    ImDrawStreamClearLists(Lists);
+    NextFrameIsKeyframe = true;
+}
+
+// Encode a single draw list into 'out_payload' (overwritten)
+static void ImDrawStreamEncodeList(ImDrawStreamEncoder* enc, const ImDrawList* draw_list, ImVector<unsigned char>* out_payload)
+{
+    // Build color palette, in order of first use
+    ImGuiStorage& palette = enc->TempPalette;
+    ImVector<ImU32>& palette_colors = enc->TempPaletteColors;
+    palette.Data.resize(0);
+    palette_colors.resize(0);
+    ImU32 prev_col = 0;
+    for (const ImDrawVert& vtx : draw_list->VtxBuffer)
+    {
+        if (vtx.col == prev_col)
+            continue;
+        if (palette.GetInt(vtx.col, -1) == -1)
+        {
+            palette.SetInt(vtx.col, palette_colors.Size);
+            palette_colors.push_back(vtx.col);
+        }
+        prev_col = vtx.col;
+    }
+
+    // Count transmitted commands (user callbacks can't be transmitted)
+    int cmd_count = 0;
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        if (cmd.UserCallback == NULL || cmd.UserCallback == ImDrawCallback_ResetRenderState)
+            cmd_count++;
+
+    const int vtx_count = draw_list->VtxBuffer.Size;
+    const int idx_count = draw_list->IdxBuffer.Size;
+    out_payload->resize(IM_DRAWSTREAM_PAYLOAD_HEADER_MAX + palette_colors.Size * 4 + cmd_count * IM_DRAWSTREAM_CMD_MAX + vtx_count * IM_DRAWSTREAM_VTX_MAX + idx_count * IM_DRAWSTREAM_VARINT_MAX);
+    unsigned char* p = out_payload->Data;
+
+    // Header + palette
+    *p++ = (unsigned char)enc->PosFracBits;
+    *p++ = (unsigned char)enc->UvFracBits;
+    p = ImDrawStreamWriteU64(p, (ImU64)cmd_count);
+    p = ImDrawStreamWriteU64(p, (ImU64)vtx_count);
+    p = ImDrawStreamWriteU64(p, (ImU64)idx_count);
+    p = ImDrawStreamWriteU64(p, (ImU64)palette_colors.Size);
+    for (ImU32 col : palette_colors)
+        p = ImDrawStreamWriteU32LE(p, col);
+
+    // Commands
+    const double pos_scale = (double)(1 << enc->PosFracBits);
+    const double uv_scale = (double)(1 << enc->UvFracBits);
+    ImS64 prev_clip[4] = { 0, 0, 0, 0 };
+    ImU64 prev_tex_id = 0;
+    unsigned int prev_vtx_offset = 0;
+    unsigned int next_idx_offset = 0;
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if (cmd.UserCallback != NULL && cmd.UserCallback != ImDrawCallback_ResetRenderState)
+            continue;
+        const ImS64 clip[4] = { ImDrawStreamQuantize(cmd.ClipRect.x, pos_scale), ImDrawStreamQuantize(cmd.ClipRect.y, pos_scale), ImDrawStreamQuantize(cmd.ClipRect.z, pos_scale), ImDrawStreamQuantize(cmd.ClipRect.w, pos_scale) };
+        const ImU64 tex_id = (ImU64)(intptr_t)cmd.TextureId;
+        int flags = 0;
+        if (memcmp(clip, prev_clip, sizeof(clip)) != 0)
+            flags |= ImDrawStreamCmdFlags_ClipRect;
+        if (tex_id != prev_tex_id)
+            flags |= ImDrawStreamCmdFlags_TextureId;
+        if (cmd.VtxOffset != prev_vtx_offset)
+            flags |= ImDrawStreamCmdFlags_VtxOffset;
+        if (cmd.IdxOffset != next_idx_offset)
+            flags |= ImDrawStreamCmdFlags_IdxOffset;
+        if (cmd.UserCallback == ImDrawCallback_ResetRenderState)
+            flags |= ImDrawStreamCmdFlags_ResetRenderState;
+
+        p = ImDrawStreamWriteU64(p, (ImU64)flags);
+        if (flags & ImDrawStreamCmdFlags_ClipRect)
+            for (int n = 0; n < 4; n++)
+                p = ImDrawStreamWriteS64(p, clip[n] - prev_clip[n]);
+        if (flags & ImDrawStreamCmdFlags_TextureId)
+            p = ImDrawStreamWriteU64(p, tex_id);
+        if (flags & ImDrawStreamCmdFlags_VtxOffset)
+            p = ImDrawStreamWriteU64(p, cmd.VtxOffset);
+        if (flags & ImDrawStreamCmdFlags_IdxOffset)
+            p = ImDrawStreamWriteU64(p, cmd.IdxOffset);
+        p = ImDrawStreamWriteU64(p, cmd.ElemCount);
+
+        memcpy(prev_clip, clip, sizeof(clip));
+        prev_tex_id = tex_id;
+        prev_vtx_offset = cmd.VtxOffset;
+        next_idx_offset = cmd.IdxOffset + cmd.ElemCount;
+    }
+
+    // Vertices
+    ImS64 prev_x = 0, prev_y = 0, prev_u = 0, prev_v = 0;
+    prev_col = 0;
+    for (const ImDrawVert& vtx : draw_list->VtxBuffer)
+    {
+        const ImS64 x = ImDrawStreamQuantize(vtx.pos.x, pos_scale);
+        const ImS64 y = ImDrawStreamQuantize(vtx.pos.y, pos_scale);
+        const ImS64 u = ImDrawStreamQuantize(vtx.uv.x, uv_scale);
+        const ImS64 v = ImDrawStreamQuantize(vtx.uv.y, uv_scale);
+        p = ImDrawStreamWriteS64(p, x - prev_x);
+        p = ImDrawStreamWriteS64(p, y - prev_y);
+        p = ImDrawStreamWriteS64(p, u - prev_u);
+        p = ImDrawStreamWriteS64(p, v - prev_v);
+        if (vtx.col == prev_col)
+            *p++ = 0;
+        else
+            p = ImDrawStreamWriteU64(p, (ImU64)palette.GetInt(vtx.col) + 1);
+        prev_x = x; prev_y = y; prev_u = u; prev_v = v;
+        prev_col = vtx.col;
+    }
+
+    // Indices
+    ImS64 prev_idx = 0;
+    for (ImDrawIdx idx : draw_list->IdxBuffer)
+    {
+        p = ImDrawStreamWriteS64(p, (ImS64)idx - prev_idx);
+        prev_idx = (ImS64)idx;
+    }
+
+    IM_ASSERT(p <= out_payload->Data + out_payload->Size);
+    out_payload->resize((int)(p - out_payload->Data));
+}
+
+void ImDrawStreamEncoder::EncodeFrame(const ImDrawData* draw_data, ImVector<unsigned char>* out_packet)
+{
+    IM_ASSERT(draw_data != NULL && out_packet != NULL);
+    IM_ASSERT(PosFracBits >= 0 && PosFracBits <= 8);
+    IM_ASSERT(UvFracBits >= 8 && UvFracBits <= 24);
+
+    const bool keyframe = NextFrameIsKeyframe;
+    if (keyframe)
+        ImDrawStreamClearLists(Lists);
+    NextFrameIsKeyframe = false;
+    FrameCount++;
+    StatsRawBytes = 0;
+    StatsListsUnchanged = StatsListsDelta = StatsListsFull = 0;
+
+    // Frame header
+    const int packet_start = out_packet->Size;
+    out_packet->resize(packet_start + IM_DRAWSTREAM_FRAME_HEADER_MAX);
+    unsigned char* p = out_packet->Data + packet_start;
+    *p++ = IM_DRAWSTREAM_VERSION;
+    p = ImDrawStreamWriteU64(p, keyframe ? ImDrawStreamFrameFlags_Keyframe : 0);
+    p = ImDrawStreamWriteF32(p, draw_data->DisplayPos.x);
+    p = ImDrawStreamWriteF32(p, draw_data->DisplayPos.y);
+    p = ImDrawStreamWriteF32(p, draw_data->DisplaySize.x);
+    p = ImDrawStreamWriteF32(p, draw_data->DisplaySize.y);
+    p = ImDrawStreamWriteF32(p, draw_data->FramebufferScale.x);
+    p = ImDrawStreamWriteF32(p, draw_data->FramebufferScale.y);
+    p = ImDrawStreamWriteU64(p, (ImU64)draw_data->CmdLists.Size);
+    out_packet->resize((int)(p - out_packet->Data));
+
+    for (int list_n = 0; list_n < draw_data->CmdLists.Size; list_n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+        StatsRawBytes += draw_list->VtxBuffer.size_in_bytes() + draw_list->IdxBuffer.size_in_bytes() + draw_list->CmdBuffer.size_in_bytes();
+
+        // Identify draw list across frames by the name of its owner window. Probe for a free key on collision.
+        ImU32 key = draw_list->_OwnerName ? ImHashStr(draw_list->_OwnerName) : ImHashData(&list_n, sizeof(list_n));
+        ImDrawStreamListState* state = ImDrawStreamFindListState(Lists, key, list_n);
+        while (state != NULL && state->LastFrame == FrameCount)
+            state = ImDrawStreamFindListState(Lists, ++key, list_n);
+        const bool is_new = (state == NULL);
+        if (is_new)
+        {
+            state = IM_NEW(ImDrawStreamListState)();
+            state->Key = key;
+            Lists.push_back(state);
+        }
+        state->LastFrame = FrameCount;
+
+        // Encode and compare with last payload for this key
+        ImDrawStreamEncodeList(this, draw_list, &TempPayload);
+        const ImVector<unsigned char>& prev = state->Payload;
+        const ImVector<unsigned char>& curr = TempPayload;
+        int mode = ImDrawStreamListMode_Full;
+        int prefix_len = 0, suffix_len = 0;
+        if (!is_new)
+        {
+            const int common_max = ImMin(prev.Size, curr.Size);
+            while (prefix_len < common_max && prev.Data[prefix_len] == curr.Data[prefix_len])
+                prefix_len++;
+            while (suffix_len < common_max - prefix_len && prev.Data[prev.Size - 1 - suffix_len] == curr.Data[curr.Size - 1 - suffix_len])
+                suffix_len++;
+            if (prev.Size == curr.Size && prefix_len == curr.Size)
+                mode = ImDrawStreamListMode_Unchanged;
+            else if (curr.Size - prefix_len - suffix_len + IM_DRAWSTREAM_VARINT_MAX < curr.Size)
+                mode = ImDrawStreamListMode_Delta;
+        }
+
+        const int middle_len = (mode == ImDrawStreamListMode_Delta) ? curr.Size - prefix_len - suffix_len : (mode == ImDrawStreamListMode_Full) ? curr.Size : 0;
+        const int list_start = out_packet->Size;
+        out_packet->resize(list_start + IM_DRAWSTREAM_LIST_HEADER_MAX + middle_len);
+        p = out_packet->Data + list_start;
+        p = ImDrawStreamWriteU64(p, key);
+        *p++ = (unsigned char)mode;
+        if (mode == ImDrawStreamListMode_Delta)
+        {
+            p = ImDrawStreamWriteU64(p, (ImU64)prefix_len);
+            p = ImDrawStreamWriteU64(p, (ImU64)suffix_len);
+            p = ImDrawStreamWriteU64(p, (ImU64)middle_len);
+            memcpy(p, curr.Data + prefix_len, (size_t)middle_len);
+            StatsListsDelta++;
+        }
+        else if (mode == ImDrawStreamListMode_Full)
+        {
+            p = ImDrawStreamWriteU64(p, (ImU64)middle_len);
+            memcpy(p, curr.Data, (size_t)middle_len);
+            StatsListsFull++;
+        }
+        else
+        {
+            StatsListsUnchanged++;
+        }
+        p += middle_len;
+        out_packet->resize((int)(p - out_packet->Data));
+        if (mode != ImDrawStreamListMode_Unchanged)
+            state->Payload.swap(TempPayload);
+    }
+
+    ImDrawStreamRemoveStaleLists(Lists, FrameCount);
+    StatsBytes = out_packet->Size - packet_start;
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] ImDrawStreamDecoder
+//-------------------------------------------------------------------------
+
+ImDrawStreamDecoder::ImDrawStreamDecoder()
+{
+    StatsListsUnchanged = StatsListsDelta = StatsListsFull = 0;
+    FrameCount = 0;
+}
+
+ImDrawStreamDecoder::~ImDrawStreamDecoder()
+{
+    DrawData.Clear();
+    ImDrawStreamClearLists(Lists);
+}
+
+void ImDrawStreamDecoder::Reset()
+{
+    DrawData.Clear();
+    ImDrawStreamClearLists(Lists);
+    FrameCount = 0;
+}
+
+// Decode a single payload into 'draw_list'. Validate everything a renderer backend relies on (index ranges in particular).
+static bool ImDrawStreamDecodeList(ImDrawStreamDecoder* dec, const unsigned char* payload, int payload_size, ImDrawList* draw_list)
+{
+    ImDrawStreamReader r(payload, (size_t)payload_size);
+    const int pos_frac_bits = r.ReadU8();
+    const int uv_frac_bits = r.ReadU8();
+    if (pos_frac_bits > 8 || uv_frac_bits < 8 || uv_frac_bits > 24)
+        return false;
+    const int cmd_count = r.ReadCount(2);
+    const int vtx_count = r.ReadCount(5);
+    const int idx_count = r.ReadCount(1);
+    const int palette_count = r.ReadCount(4);
+    if (r.Error)
+        return false;
+
+    ImVector<ImU32>& palette_colors = dec->TempPaletteColors;
+    palette_colors.resize(palette_count);
+    for (int n = 0; n < palette_count; n++)
+        palette_colors[n] = r.ReadU32LE();
+
+    // Commands
+    const float pos_scale_inv = 1.0f / (float)(1 << pos_frac_bits);
+    const float uv_scale_inv = 1.0f / (float)(1 << uv_frac_bits);
+    draw_list->CmdBuffer.resize(cmd_count);
+    ImS64 clip[4] = { 0, 0, 0, 0 };
+    ImU64 tex_id = 0;
+    unsigned int vtx_offset = 0;
+    unsigned int idx_offset = 0;
+    for (int cmd_n = 0; cmd_n < cmd_count && !r.Error; cmd_n++)
+    {
+        ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+        cmd = ImDrawCmd();
+        const ImU64 flags = r.ReadU64();
+        if (flags & ImDrawStreamCmdFlags_ClipRect)
+            for (int n = 0; n < 4; n++)
+                clip[n] += r.ReadS64();
+        if (flags & ImDrawStreamCmdFlags_TextureId)
+            tex_id = r.ReadU64();
+        if (flags & ImDrawStreamCmdFlags_VtxOffset)
+            vtx_offset = (unsigned int)r.ReadU64();
+        if (flags & ImDrawStreamCmdFlags_IdxOffset)
+            idx_offset = (unsigned int)r.ReadU64();
+        const ImU64 elem_count = r.ReadU64();
+        if (elem_count > (ImU64)idx_count || idx_offset > (unsigned int)idx_count - (unsigned int)elem_count)
+            return false;
+        cmd.ClipRect = ImVec4((float)clip[0] * pos_scale_inv, (float)clip[1] * pos_scale_inv, (float)clip[2] * pos_scale_inv, (float)clip[3] * pos_scale_inv);
+        cmd.TextureId = (ImTextureID)(intptr_t)tex_id;
+        cmd.VtxOffset = vtx_offset;
+        cmd.IdxOffset = idx_offset;
+        cmd.ElemCount = (unsigned int)elem_count;
+        cmd.UserCallback = (flags & ImDrawStreamCmdFlags_ResetRenderState) ? ImDrawCallback_ResetRenderState : NULL;
+        cmd.UserCallbackDataOffset = -1;
+        idx_offset += cmd.ElemCount;
+    }
+    if (r.Error)
+        return false;
+
+    // Vertices
+    draw_list->VtxBuffer.resize(vtx_count);
+    ImS64 x = 0, y = 0, u = 0, v = 0;
+    ImU32 col = 0;
+    for (ImDrawVert& vtx : draw_list->VtxBuffer)
+    {
+        x += r.ReadS64();
+        y += r.ReadS64();
+        u += r.ReadS64();
+        v += r.ReadS64();
+        const ImU64 col_code = r.ReadU64();
+        if (col_code != 0)
+        {
+            if (col_code > (ImU64)palette_count)
+                return false;
+            col = palette_colors[(int)col_code - 1];
+        }
+        vtx.pos = ImVec2((float)x * pos_scale_inv, (float)y * pos_scale_inv);
+        vtx.uv = ImVec2((float)u * uv_scale_inv, (float)v * uv_scale_inv);
+        vtx.col = col;
+    }
+    if (r.Error)
+        return false;
+
+    // Indices
+    draw_list->IdxBuffer.resize(idx_count);
+    ImS64 idx = 0;
+    for (ImDrawIdx& out_idx : draw_list->IdxBuffer)
+    {
+        idx += r.ReadS64();
+        if (idx < 0 || idx >= vtx_count || (ImU64)idx != (ImU64)(ImDrawIdx)idx)
+            return false;
+        out_idx = (ImDrawIdx)idx;
+    }
+    if (r.Error || r.P != r.End)
+        return false;
+
+    // Validate that all indices referenced by commands, once offset by VtxOffset, are within the vertex buffer
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        for (unsigned int n = cmd.IdxOffset; n < cmd.IdxOffset + cmd.ElemCount; n++)
+            if ((ImU64)cmd.VtxOffset + draw_list->IdxBuffer.Data[n] >= (ImU64)vtx_count)
+                return false;
+    return true;
+}
+
+bool ImDrawStreamDecoder::DecodeFrame(const void* packet, size_t packet_size)
+{
+    DrawData.Clear();
+    StatsListsUnchanged = StatsListsDelta = StatsListsFull = 0;
+
+    ImDrawStreamReader r(packet, packet_size);
+    const int version = r.ReadU8();
+    const ImU64 frame_flags = r.ReadU64();
+    if (r.Error || version != IM_DRAWSTREAM_VERSION)
+        return false;
+    if (frame_flags & ImDrawStreamFrameFlags_Keyframe)
+    {
+        ImDrawStreamClearLists(Lists);
+        FrameCount = 0;
+    }
+    else if (FrameCount == 0)
+    {
+        return false; // Need a keyframe first
+    }
+
+    ImVec2 display_pos, display_size, framebuffer_scale;
+    display_pos.x = r.ReadF32();
+    display_pos.y = r.ReadF32();
+    display_size.x = r.ReadF32();
+    display_size.y = r.ReadF32();
+    framebuffer_scale.x = r.ReadF32();
+    framebuffer_scale.y = r.ReadF32();
+    const int list_count = r.ReadCount(2);
+
+    // Any failure from this point leaves us out of sync: require a keyframe.
+    FrameCount++;
+    bool ok = !r.Error;
+    for (int list_n = 0; list_n < list_count && ok; list_n++)
+    {
+        const ImU64 key = r.ReadU64();
+        const int mode = r.ReadU8();
+        if (r.Error || key > 0xFFFFFFFF)
+        {
+            ok = false;
+            break;
+        }
+        ImDrawStreamListState* state = ImDrawStreamFindListState(Lists, (ImU32)key, list_n);
+        if (state != NULL && state->LastFrame == FrameCount)
+        {
+            ok = false; // Duplicate key
+            break;
+        }
+
+        if (mode == ImDrawStreamListMode_Unchanged)
+        {
+            if (state == NULL)
+                ok = false;
+            else
+                StatsListsUnchanged++;
+        }
+        else if (mode == ImDrawStreamListMode_Delta)
+        {
+            const ImU64 prefix_len = r.ReadU64();
+            const ImU64 suffix_len = r.ReadU64();
+            const ImU64 middle_len = r.ReadU64();
+            if (r.Error || state == NULL || middle_len > (ImU64)r.Remaining() || prefix_len > (ImU64)state->Payload.Size || suffix_len > (ImU64)state->Payload.Size - prefix_len || prefix_len + middle_len + suffix_len > (ImU64)INT_MAX)
+            {
+                ok = false;
+                break;
+            }
+            const ImVector<unsigned char>& prev = state->Payload;
+            TempPayload.resize((int)(prefix_len + middle_len + suffix_len));
+            memcpy(TempPayload.Data, prev.Data, (size_t)prefix_len);
+            memcpy(TempPayload.Data + prefix_len, r.ReadBytes((size_t)middle_len), (size_t)middle_len);
+            memcpy(TempPayload.Data + prefix_len + middle_len, prev.Data + prev.Size - suffix_len, (size_t)suffix_len);
+            state->Payload.swap(TempPayload);
+            ok = ImDrawStreamDecodeList(this, state->Payload.Data, state->Payload.Size, state->DrawList);
+            StatsListsDelta++;
+        }
+        else if (mode == ImDrawStreamListMode_Full)
+        {
+            const ImU64 payload_len = r.ReadU64();
+            if (r.Error || payload_len > (ImU64)r.Remaining())
+            {
+                ok = false;
+                break;
+            }
+            if (state == NULL)
+            {
+                state = IM_NEW(ImDrawStreamListState)();
+                state->Key = (ImU32)key;
+                state->DrawList = IM_NEW(ImDrawList)(NULL);
+                Lists.push_back(state);
+            }
+            state->Payload.resize((int)payload_len);
+            memcpy(state->Payload.Data, r.ReadBytes((size_t)payload_len), (size_t)payload_len);
+            ok = ImDrawStreamDecodeList(this, state->Payload.Data, state->Payload.Size, state->DrawList);
+            StatsListsFull++;
+        }
+        else
+        {
+            ok = false;
+        }
+        if (!ok)
+            break;
+
+        state->LastFrame = FrameCount;
+        DrawData.CmdLists.push_back(state->DrawList);
+        DrawData.TotalVtxCount += state->DrawList->VtxBuffer.Size;
+        DrawData.TotalIdxCount += state->DrawList->IdxBuffer.Size;
+    }
+    if (!ok || r.P != r.End)
+    {
+        DrawData.Clear();
+        FrameCount = 0;
+        return false;
+    }
+
+    ImDrawStreamRemoveStaleLists(Lists, FrameCount);
+    DrawData.Valid = true;
+    DrawData.CmdListsCount = DrawData.CmdLists.Size;
+    DrawData.DisplayPos = display_pos;
+    DrawData.DisplaySize = display_size;
+    DrawData.FramebufferScale = framebuffer_scale;
+    return true;
+}
+
+//-------------------------------------------------------------------------
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,103 @@
+// dear imgui: compact binary stream of ImDrawData, with inter-frame delta compression
+// (headers)
+
+// Usage:
+// - Add misc/drawstream/imgui_drawstream.cpp to your project on both sides.
+// - On the sending side (e.g. headless server), after ImGui::Render():
+//      static ImDrawStreamEncoder encoder;
+//      ImVector<unsigned char> packet;
+//      encoder.EncodeFrame(ImGui::GetDrawData(), &packet);
+//      MySend(packet.Data, packet.Size);
+// - On the receiving side (e.g. thin viewer), for each packet received in order:
+//      static ImDrawStreamDecoder decoder;
+//      if (decoder.DecodeFrame(data, size))
+//          ImGui_ImplXXXX_RenderDrawData(&decoder.DrawData);
+//      else
+//          MyRequestKeyframe(); // Sender should call encoder.Reset(): next packet will be self-contained.
+// - See examples/example_null_drawstream/ for a loopback example which also reports bandwidth and timings.
+
+// Stream format (all integers are LEB128 varints, signed values are zigzag-encoded, floats are little-endian IEEE 754):
+// - Frame header: version, flags (keyframe), quantization settings, DisplayPos/DisplaySize/FramebufferScale, number of draw lists.
+// - For each draw list: a key (hash of owner window name) + one of:
+//   - 'Unchanged': same contents as last frame. Costs 2-6 bytes. The decoder reuses its ImDrawList as-is.
+//   - 'Delta': common prefix/suffix lengths against last frame's payload for this key, followed by the differing bytes.
+//   - 'Full': the whole payload.
+// - A payload encodes a single ImDrawList:
+//   - Color palette (in order of first use), then draw commands (clip rectangles delta-coded), then vertices, then indices.
+//   - Vertex positions are quantized to 1/(1<<PosFracBits) pixel, UVs to 1/(1<<UvFracBits), both delta-coded against the previous vertex.
+//     Because positions are relative, moving a window only alters a few bytes of its payload.
+//   - Vertex colors are coded as an index into the palette, or a single zero byte when identical to previous vertex.
+//   - Indices are delta-coded against the previous index.
+// - Draw lists missing from a frame are forgotten by both sides.
+
+// Limitations:
+// - ImTextureID values are transmitted unmodified (as 64-bit integers). They need to be meaningful on the receiving side,
+//   e.g. set the same small integer identifiers on both sides with ImFontAtlas::SetTexID(). ImTextureID needs to be an integer or pointer type.
+// - User callbacks cannot be transmitted, except for ImDrawCallback_ResetRenderState. Commands with other callbacks are dropped.
+// - Quantization is lossy: a decoded frame is not bit-exact with the original.
+
+#pragma once
+#include "imgui.h"      // IMGUI_API, ImDrawData
+#ifndef IMGUI_DISABLE
+
+// [Internal] Persistent per-draw list state, on both sides
+struct ImDrawStreamListState
+{
+    ImU32                   Key;
+    int                     LastFrame;          // Last frame index this key was seen in
+    ImVector<unsigned char> Payload;            // Last payload sent/received for this key
+    ImDrawList*             DrawList;           // Decoder only: decoded draw list, reused when unchanged.
+
+    ImDrawStreamListState() { Key = 0; LastFrame = -1; DrawList = NULL; }
+};
+
+// Encoder (sending side)
+struct IMGUI_API ImDrawStreamEncoder
+{
+    int                     PosFracBits;        // = 4      // Vertex positions and clip rectangles are quantized to 1/(1<<PosFracBits) pixel. Range 0..8.
+    int                     UvFracBits;         // = 16     // Texture coordinates are quantized to 1/(1<<UvFracBits). Range 8..24.
+
+    // Statistics for last encoded frame
+    int                     StatsBytes;         // Size of last frame packet.
+    int                     StatsRawBytes;      // Size of last frame's uncompressed vertices, indices and commands (for reference).
+    int                     StatsListsUnchanged;
+    int                     StatsListsDelta;
+    int                     StatsListsFull;
+
+    // [Internal]
+    int                     FrameCount;
+    bool                    NextFrameIsKeyframe;
+    ImVector<ImDrawStreamListState*> Lists;
+    ImVector<unsigned char> TempPayload;
+    ImGuiStorage            TempPalette;        // Color -> palette index
+    ImVector<ImU32>         TempPaletteColors;
+
+    ImDrawStreamEncoder();
+    ~ImDrawStreamEncoder();
+    void                    Reset();                                                        // Forget all state: next frame will be a keyframe, which may be decoded by a new/reset decoder.
+    void                    EncodeFrame(const ImDrawData* draw_data, ImVector<unsigned char>* out_packet);  // Append encoded frame to 'out_packet'.
+};
+
+// Decoder (receiving side)
+struct IMGUI_API ImDrawStreamDecoder
+{
+    ImDrawData              DrawData;           // Last decoded frame. Pass to your renderer backend. Draw lists are owned by the decoder.
+
+    // Statistics for last decoded frame
+    int                     StatsListsUnchanged;
+    int                     StatsListsDelta;
+    int                     StatsListsFull;
+
+    // [Internal]
+    int                     FrameCount;
+    ImVector<ImDrawStreamListState*> Lists;
+    ImVector<unsigned char> TempPayload;
+    ImVector<ImU32>         TempPaletteColors;
+
+    ImDrawStreamDecoder();
+    ~ImDrawStreamDecoder();
+    void                    Reset();                                                        // Forget all state: only a keyframe may be decoded next.
+    bool                    DecodeFrame(const void* packet, size_t packet_size);            // Return false on malformed/out-of-sync packet: caller should request a keyframe. DrawData is left invalid.
+};
+
+#endif // #ifndef IMGUI_DISABLE
@@ -3,11 +3,12 @@
 // Helper tool to turn a file into a C array, if you want to embed font data in your source code.
 
 // The data is first compressed with stb_compress() to reduce source code size.
+// Alternatively it can be compressed in LZ4 blocks (-lz4): generally smaller, and ~5x faster to decompress at startup.
 // Then stored in a C array:
 // - Base85:   ~5 bytes of source code for 4 bytes of input data. 5 bytes stored in binary (suggested by @mmalex).
 // - As int:  ~11 bytes of source code for 4 bytes of input data. 4 bytes stored in binary. Endianness dependant, need swapping on big-endian CPU.
 // - As char: ~12 bytes of source code for 4 bytes of input data. 4 bytes stored in binary. Not endianness dependant.
-// Load compressed TTF fonts with ImGui::GetIO().Fonts->AddFontFromMemoryCompressedTTF()
+// Load compressed TTF fonts with ImGui::GetIO().Fonts->AddFontFromMemoryCompressedTTF(), which reads both compression formats.
 
 // Build with, e.g:
 //   # cl.exe binary_to_compressed_c.cpp
@@ -16,10 +17,12 @@
 // You can also find a precompiled Windows binary in the binary/demo package available from https://github.com/ocornut/imgui
 
 // Usage:
-//   binary_to_compressed_c.exe [-nocompress] [-nostatic] [-base85] <inputfile> <symbolname>
+//   binary_to_compressed_c.exe [-u8|-u32|-base85] [-lz4] [-nocompress] [-nostatic] <inputfile> <symbolname>
 // Usage example:
 //   # binary_to_compressed_c.exe myfont.ttf MyFont > myfont.cpp
 //   # binary_to_compressed_c.exe -base85 myfont.ttf MyFont > myfont.cpp
+//   # binary_to_compressed_c.exe -lz4 myfont.ttf MyFont > myfont.cpp
+// Define BINARY_TO_COMPRESSED_C_NO_MAIN to include this file and use the compressors from another program (e.g. examples/example_null_fonts_benchmark).
 // Note:
 //   Base85 encoding will be obsoleted by future version of Dear ImGui!
 
@@ -34,6 +37,10 @@ typedef unsigned int stb_uint;
 typedef unsigned char stb_uchar;
 stb_uint stb_compress(stb_uchar* out, stb_uchar* in, stb_uint len);
 
+// LZ4 blocks - declaration
+static int lz4_blocks_compress_bound(int len);
+static int lz4_blocks_compress(unsigned char* out, const unsigned char* in, int len);
+
 enum SourceEncoding
 {
     SourceEncoding_U8,      // New default since 2024/11
@@ -41,22 +48,40 @@ enum SourceEncoding
     SourceEncoding_Base85,
 };
 
-static bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static);
+enum Compression
+{
+    Compression_None,
+    Compression_Stb,        // Default
+    Compression_LZ4,
+};
+
+char Encode85Byte(unsigned int x)
+{
+    x = (x % 85) + 35;
+    return (char)((x >= '\\') ? x + 1 : x);
+}
+
+#ifndef BINARY_TO_COMPRESSED_C_NO_MAIN
+static bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, Compression compression, bool use_static);
 
 int main(int argc, char** argv)
 {
     if (argc < 3)
     {
-        printf("Syntax: %s [-u8|-u32|-base85] [-nocompress] [-nostatic] <inputfile> <symbolname>\n", argv[0]);
+        printf("Syntax: %s [-u8|-u32|-base85] [-lz4] [-nocompress] [-nostatic] <inputfile> <symbolname>\n", argv[0]);
         printf("Source encoding types:\n");
         printf(" -u8     = ~12 bytes of source per 4 bytes of data. 4 bytes in binary.\n");
         printf(" -u32    = ~11 bytes of source per 4 bytes of data. 4 bytes in binary. Need endianness swapping on big-endian.\n");
         printf(" -base85 =  ~5 bytes of source per 4 bytes of data. 5 bytes in binary. Need decoder.\n");
+        printf("Compression types:\n");
+        printf(" (default)   = stb_compress().\n");
+        printf(" -lz4        = LZ4 blocks. Generally smaller than stb_compress(), ~5x faster to decompress. Need Dear ImGui 1.91.7+ to load.\n");
+        printf(" -nocompress = No compression.\n");
         return 0;
     }
 
     int argn = 1;
-    bool use_compression = true;
+    Compression compression = Compression_Stb;
     bool use_static = true;
     SourceEncoding source_encoding = SourceEncoding_U8; // New default
     while (argn < (argc - 2) && argv[argn][0] == '-')
@@ -64,7 +89,8 @@ int main(int argc, char** argv)
         if (strcmp(argv[argn], "-u8") == 0) { source_encoding = SourceEncoding_U8; argn++; }
         else if (strcmp(argv[argn], "-u32") == 0) { source_encoding = SourceEncoding_U32; argn++; }
         else if (strcmp(argv[argn], "-base85") == 0) { source_encoding = SourceEncoding_Base85; argn++; }
-        else if (strcmp(argv[argn], "-nocompress") == 0) { use_compression = false; argn++; }
+        else if (strcmp(argv[argn], "-lz4") == 0) { compression = Compression_LZ4; argn++; }
+        else if (strcmp(argv[argn], "-nocompress") == 0) { compression = Compression_None; argn++; }
         else if (strcmp(argv[argn], "-nostatic") == 0) { use_static = false; argn++; }
         else
         {
@@ -73,19 +99,13 @@ int main(int argc, char** argv)
         }
     }
 
-    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], source_encoding, use_compression, use_static);
+    bool ret = binary_to_compressed_c(argv[argn], argv[argn + 1], source_encoding, compression, use_static);
     if (!ret)
         fprintf(stderr, "Error opening or reading file: '%s'\n", argv[argn]);
     return ret ? 0 : 1;
 }
 
-char Encode85Byte(unsigned int x)
-{
-    x = (x % 85) + 35;
-    return (char)((x >= '\\') ? x + 1 : x);
-}
-
-bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, bool use_compression, bool use_static)
+bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEncoding source_encoding, Compression compression, bool use_static)
 {
     // Read file
     FILE* f = fopen(filename, "rb");
@@ -98,9 +118,15 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
     fclose(f);
 
     // Compress
-    int maxlen = data_sz + 512 + (data_sz >> 2) + sizeof(int); // total guess
+    const bool use_compression = (compression != Compression_None);
+    int maxlen = (compression == Compression_LZ4) ? lz4_blocks_compress_bound(data_sz) : data_sz + 512 + (data_sz >> 2) + sizeof(int); // total guess
+    maxlen += 4; // Padding for u32/base85 encoding
     char* compressed = use_compression ? new char[maxlen] : data;
-    int compressed_sz = use_compression ? stb_compress((stb_uchar*)compressed, (stb_uchar*)data, data_sz) : data_sz;
+    int compressed_sz = data_sz;
+    if (compression == Compression_Stb)
+        compressed_sz = stb_compress((stb_uchar*)compressed, (stb_uchar*)data, data_sz);
+    else if (compression == Compression_LZ4)
+        compressed_sz = lz4_blocks_compress((unsigned char*)compressed, (const unsigned char*)data, data_sz);
     if (use_compression)
         memset(compressed + compressed_sz, 0, maxlen - compressed_sz);
 
@@ -109,9 +135,10 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
     fprintf(out, "// File: '%s' (%d bytes)\n", filename, (int)data_sz);
     const char* static_str = use_static ? "static " : "";
     const char* compressed_str = use_compression ? "compressed_" : "";
+    const char* compression_arg = (compression == Compression_LZ4) ? "-lz4 " : "";
     if (source_encoding == SourceEncoding_Base85)
     {
-        fprintf(out, "// Exported using binary_to_compressed_c.exe -base85 \"%s\" %s\n", filename, symbol);
+        fprintf(out, "// Exported using binary_to_compressed_c.exe -base85 %s\"%s\" %s\n", compression_arg, filename, symbol);
         fprintf(out, "%sconst char %s_%sdata_base85[%d+1] =\n    \"", static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*5);
         char prev_c = 0;
         for (int src_i = 0; src_i < compressed_sz; src_i += 4)
@@ -132,7 +159,7 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
     else if (source_encoding == SourceEncoding_U8)
     {
         // As individual bytes, not subject to endianness issues.
-        fprintf(out, "// Exported using binary_to_compressed_c.exe -u8 \"%s\" %s\n", filename, symbol);
+        fprintf(out, "// Exported using binary_to_compressed_c.exe -u8 %s\"%s\" %s\n", compression_arg, filename, symbol);
         fprintf(out, "%sconst unsigned int %s_%ssize = %d;\n", static_str, symbol, compressed_str, (int)compressed_sz);
         fprintf(out, "%sconst unsigned char %s_%sdata[%d] =\n{", static_str, symbol, compressed_str, (int)compressed_sz);
         int column = 0;
@@ -150,7 +177,7 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
     else if (source_encoding == SourceEncoding_U32)
     {
         // As integers
-        fprintf(out, "// Exported using binary_to_compressed_c.exe -u32 \"%s\" %s\n", filename, symbol);
+        fprintf(out, "// Exported using binary_to_compressed_c.exe -u32 %s\"%s\" %s\n", compression_arg, filename, symbol);
         fprintf(out, "%sconst unsigned int %s_%ssize = %d;\n", static_str, symbol, compressed_str, (int)compressed_sz);
         fprintf(out, "%sconst unsigned int %s_%sdata[%d/4] =\n{", static_str, symbol, compressed_str, (int)((compressed_sz + 3) / 4)*4);
         int column = 0;
@@ -171,6 +198,7 @@ bool binary_to_compressed_c(const char* filename, const char* symbol, SourceEnco
         delete[] compressed;
     return true;
 }
+#endif // #ifndef BINARY_TO_COMPRESSED_C_NO_MAIN
 
 // stb_compress* from stb.h - definition
 
@@ -422,3 +450,155 @@ stb_uint stb_compress(stb_uchar *out, stb_uchar *input, stb_uint length)
 
     return (stb_uint)(stb__out - out);
 }
+
+// LZ4 blocks - definition
+// Header, then compressed size of each block, then blocks. All values are 32-bit little-endian (see ImFontDecompress() in imgui_draw.cpp).
+// Blocks are standard LZ4 blocks (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md), compressed independently so they
+// can be decompressed in parallel. We use a hash chain match finder: slow, but we only compress once and favor ratio.
+
+#define LZ4_BLOCK_SIZE      (128 * 1024)
+#define LZ4_MIN_MATCH       4
+#define LZ4_MAX_OFFSET      65535
+#define LZ4_LAST_LITERALS   5       // Last 5 bytes of a block are always literals
+#define LZ4_MATCH_LIMIT     12      // Last match must start at least 12 bytes before the end of a block
+#define LZ4_HASH_LOG        16
+#define LZ4_CHAIN_DEPTH     256
+#define LZ4_GOOD_MATCH      1024    // Stop searching when finding a match this long
+
+static void lz4_write_u32(unsigned char* out, unsigned int v)
+{
+    out[0] = (unsigned char)v; out[1] = (unsigned char)(v >> 8); out[2] = (unsigned char)(v >> 16); out[3] = (unsigned char)(v >> 24);
+}
+
+static unsigned char* lz4_write_length(unsigned char* out, int len)
+{
+    for (; len >= 255; len -= 255)
+        *out++ = 255;
+    *out++ = (unsigned char)len;
+    return out;
+}
+
+static unsigned char* lz4_write_sequence(unsigned char* out, const unsigned char* literals, int literal_len, int offset, int match_len)
+{
+    unsigned char* token = out++;
+    *token = (unsigned char)((literal_len >= 15 ? 15 : literal_len) << 4);
+    if (literal_len >= 15)
+        out = lz4_write_length(out, literal_len - 15);
+    memcpy(out, literals, literal_len);
+    out += literal_len;
+    if (match_len == 0)
+        return out; // Last sequence
+    *out++ = (unsigned char)offset;
+    *out++ = (unsigned char)(offset >> 8);
+    match_len -= LZ4_MIN_MATCH;
+    *token |= (unsigned char)(match_len >= 15 ? 15 : match_len);
+    if (match_len >= 15)
+        out = lz4_write_length(out, match_len - 15);
+    return out;
+}
+
+static unsigned int lz4_hash(const unsigned char* p)
+{
+    unsigned int v = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+    return (v * 2654435761u) >> (32 - LZ4_HASH_LOG);
+}
+
+static void lz4_insert(const unsigned char* in, int pos, int* head, int* chain)
+{
+    const unsigned int h = lz4_hash(in + pos);
+    chain[pos] = head[h];
+    head[h] = pos;
+}
+
+// Find longest match for position 'pos', inserting it into the hash chain.
+static int lz4_find_match(const unsigned char* in, int pos, int match_limit, int* head, int* chain, int* out_offset)
+{
+    const unsigned int h = lz4_hash(in + pos);
+    int best_len = 0;
+    for (int candidate = head[h], depth = 0; candidate >= 0 && pos - candidate <= LZ4_MAX_OFFSET && depth < LZ4_CHAIN_DEPTH && best_len < LZ4_GOOD_MATCH; candidate = chain[candidate], depth++)
+    {
+        if (in[candidate + best_len] != in[pos + best_len])
+            continue;
+        int len = 0;
+        while (pos + len < match_limit && in[candidate + len] == in[pos + len])
+            len++;
+        if (len > best_len)
+        {
+            best_len = len;
+            *out_offset = pos - candidate;
+        }
+    }
+    chain[pos] = head[h];
+    head[h] = pos;
+    return best_len >= LZ4_MIN_MATCH ? best_len : 0;
+}
+
+static int lz4_compress_block(unsigned char* out, const unsigned char* in, int len, int* head, int* chain)
+{
+    for (int i = 0; i < (1 << LZ4_HASH_LOG); i++)
+        head[i] = -1;
+    unsigned char* out_begin = out;
+    const int match_limit = len - LZ4_LAST_LITERALS;    // Matches must end before this
+    const int start_limit = len - LZ4_MATCH_LIMIT;      // Matches must start before this
+    int literal_start = 0;
+    int pos = 0;
+    while (pos < start_limit)
+    {
+        int offset = 0;
+        int match_len = lz4_find_match(in, pos, match_limit, head, chain, &offset);
+        if (match_len == 0)
+        {
+            pos++;
+            continue;
+        }
+
+        // Lazy matching: prefer a longer match starting at next byte
+        while (pos + 1 < start_limit)
+        {
+            int next_offset = 0;
+            int next_match_len = lz4_find_match(in, pos + 1, match_limit, head, chain, &next_offset);
+            if (next_match_len <= match_len)
+                break;
+            pos++;
+            match_len = next_match_len;
+            offset = next_offset;
+        }
+
+        out = lz4_write_sequence(out, in + literal_start, pos - literal_start, offset, match_len);
+        for (int i = pos + 2; i < pos + match_len && i < start_limit; i++) // pos + 1 was inserted by lazy matching
+            lz4_insert(in, i, head, chain);
+        pos += match_len;
+        literal_start = pos;
+    }
+    out = lz4_write_sequence(out, in + literal_start, len - literal_start, 0, 0);
+    return (int)(out - out_begin);
+}
+
+static int lz4_blocks_compress_bound(int len)
+{
+    const int block_count = (len + LZ4_BLOCK_SIZE - 1) / LZ4_BLOCK_SIZE;
+    return 16 + block_count * 4 + len + (len / 255) + block_count * 16;
+}
+
+static int lz4_blocks_compress(unsigned char* out, const unsigned char* in, int len)
+{
+    const int block_count = (len + LZ4_BLOCK_SIZE - 1) / LZ4_BLOCK_SIZE;
+    lz4_write_u32(out + 0, 0x345A4C49); // "ILZ4"
+    lz4_write_u32(out + 4, (unsigned int)len);
+    lz4_write_u32(out + 8, LZ4_BLOCK_SIZE);
+    lz4_write_u32(out + 12, (unsigned int)block_count);
+    int out_len = 16 + block_count * 4;
+
+    int* head = (int*)malloc(sizeof(int) * (1 << LZ4_HASH_LOG));
+    int* chain = (int*)malloc(sizeof(int) * LZ4_BLOCK_SIZE);
+    for (int block_n = 0; block_n < block_count; block_n++)
+    {
+        const int block_len = (len - block_n * LZ4_BLOCK_SIZE < LZ4_BLOCK_SIZE) ? len - block_n * LZ4_BLOCK_SIZE : LZ4_BLOCK_SIZE;
+        const int block_out_len = lz4_compress_block(out + out_len, in + block_n * LZ4_BLOCK_SIZE, block_len, head, chain);
+        lz4_write_u32(out + 16 + block_n * 4, (unsigned int)block_out_len);
+        out_len += block_out_len;
+    }
+    free(head);
+    free(chain);
+    return out_len;
+}
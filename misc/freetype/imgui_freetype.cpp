@@ -6,6 +6,8 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026/10/19: added support for ImFontAtlas::TexPageSize to pack glyphs into multiple texture pages.
+//  2026/10/19: added support for ImFontAtlasFlags_SDF to build signed distance field atlases (requires FreeType 2.11+).
 //  2024/10/17: added plutosvg support for SVG Fonts (seems faster/better than lunasvg). Enable by using '#define IMGUI_ENABLE_FREETYPE_PLUTOSVG'. (#7927)
 //  2023/11/13: added support for ImFontConfig::RasterizationDensity field for scaling render density without scaling metrics.
 //  2023/08/01: added support for SVG fonts, enable by using '#define IMGUI_ENABLE_FREETYPE_LUNASVG'. (#6591)
@@ -447,8 +449,22 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
 
     ImFontAtlasBuildInit(atlas);
 
+    // Signed distance fields: FreeType 'sdf' (outlines) and 'bsdf' (bitmaps) renderers output 128 on the edge, covering 'spread' pixels each way.
+    if (atlas->Flags & ImFontAtlasFlags_SDF)
+    {
+#if ((FREETYPE_MAJOR >= 2) && (FREETYPE_MINOR >= 11))
+        FT_Int spread = atlas->TexSdfSpread;
+        FT_Property_Set(ft_library, "sdf", "spread", &spread);
+        FT_Property_Set(ft_library, "bsdf", "spread", &spread);
+#else
+        IM_ASSERT(0 && "ImFontAtlasFlags_SDF requires FreeType version >= 2.11");
+        return false;
+#endif
+    }
+
     // Clear atlas
     atlas->TexID = 0;
+    atlas->TexPageIDs.clear();
     atlas->TexWidth = atlas->TexHeight = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
@@ -483,9 +499,17 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
         // Load font
         if (!font_face.InitFont(ft_library, cfg, extra_flags))
             return false;
+        if (atlas->Flags & ImFontAtlasFlags_SDF)
+        {
+            // Distance fields are single channel: color glyphs are rendered from their outlines.
+            font_face.LoadFlags &= ~FT_LOAD_COLOR;
+#if ((FREETYPE_MAJOR >= 2) && (FREETYPE_MINOR >= 11))
+            font_face.RenderMode = FT_RENDER_MODE_SDF;
+#endif
+        }
 
         // Measure highest codepoints
-        src_load_color |= (cfg.FontBuilderFlags & ImGuiFreeTypeBuilderFlags_LoadColor) != 0;
+        src_load_color |= (font_face.LoadFlags & FT_LOAD_COLOR) != 0;
         ImFontBuildDstDataFT& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
         src_tmp.SrcRanges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
         for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
@@ -584,8 +608,8 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
         src_tmp.Rects = &buf_rects[buf_rects_out_n];
         buf_rects_out_n += src_tmp.GlyphsCount;
 
-        // Compute multiply table if requested
-        const bool multiply_enabled = (cfg.RasterizerMultiply != 1.0f);
+        // Compute multiply table if requested (doesn't apply to distances)
+        const bool multiply_enabled = (cfg.RasterizerMultiply != 1.0f) && !(atlas->Flags & ImFontAtlasFlags_SDF);
         unsigned char multiply_table[256];
         if (multiply_enabled)
             ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
@@ -635,6 +659,8 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
         atlas->TexWidth = atlas->TexDesiredWidth;
     else
         atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : 512;
+    if (atlas->TexPageSize > 0)
+        atlas->TexWidth = ImMin(atlas->TexWidth, atlas->TexPageSize);
 
     // 5. Start packing
     // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
@@ -643,17 +669,18 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
     ImVector<stbrp_node> pack_nodes;
     pack_nodes.resize(num_nodes_for_packing_algorithm);
     stbrp_context pack_context;
-    stbrp_init_target(&pack_context, atlas->TexWidth - atlas->TexGlyphPadding, TEX_HEIGHT_MAX - atlas->TexGlyphPadding, pack_nodes.Data, pack_nodes.Size);
+    stbrp_init_target(&pack_context, atlas->TexWidth - atlas->TexGlyphPadding, ((atlas->TexPageSize > 0) ? atlas->TexPageSize : TEX_HEIGHT_MAX) - atlas->TexGlyphPadding, pack_nodes.Data, pack_nodes.Size);
     ImFontAtlasBuildPackCustomRects(atlas, &pack_context);
 
     // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
+    // With TexPageSize > 0, the texture is a stack of pages and rectangles spill into new pages when the current one is full.
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcDataFT& src_tmp = src_tmp_array[src_i];
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        stbrp_pack_rects(&pack_context, src_tmp.Rects, src_tmp.GlyphsCount);
+        ImFontAtlasBuildPackFontRects(atlas, &pack_context, pack_nodes.Data, src_tmp.Rects, src_tmp.GlyphsCount);
 
         // Extend texture height and mark missing glyphs as non-packed so we won't render them.
         // FIXME: We are not handling packing failure here (would happen if we got off TEX_HEIGHT_MAX or if a single if larger than TexWidth?)
@@ -664,16 +691,18 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
 
     // 7. Allocate texture
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
+    if (atlas->TexPageSize > 0)
+        atlas->TexHeight = (atlas->TexPageIDs.Size > 0) ? atlas->TexPageSize : ImMin(atlas->TexHeight, atlas->TexPageSize);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     if (src_load_color)
     {
-        size_t tex_size = (size_t)atlas->TexWidth * atlas->TexHeight * 4;
+        size_t tex_size = (size_t)atlas->TexWidth * atlas->TexHeight * atlas->GetTexPageCount() * 4;
         atlas->TexPixelsRGBA32 = (unsigned int*)IM_ALLOC(tex_size);
         memset(atlas->TexPixelsRGBA32, 0, tex_size);
     }
     else
     {
-        size_t tex_size = (size_t)atlas->TexWidth * atlas->TexHeight * 1;
+        size_t tex_size = (size_t)atlas->TexWidth * atlas->TexHeight * atlas->GetTexPageCount() * 1;
         atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(tex_size);
         memset(atlas->TexPixelsAlpha8, 0, tex_size);
     }
@@ -714,6 +743,8 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
             IM_ASSERT(info.Height + padding <= pack_rect.h);
             const int tx = pack_rect.x + padding;
             const int ty = pack_rect.y + padding;
+            const int tex_page = ty / atlas->TexHeight; // Pages are stacked vertically, make V relative to the glyph's page
+            const int tex_page_ty = ty - tex_page * atlas->TexHeight;
 
             // Register glyph
             float x0 = info.OffsetX * src_tmp.Font.InvRasterizationDensity + font_off_x;
@@ -721,10 +752,10 @@ bool ImFontAtlasBuildWithFreeTypeEx(FT_Library ft_library, ImFontAtlas* atlas, u
             float x1 = x0 + info.Width * src_tmp.Font.InvRasterizationDensity;
             float y1 = y0 + info.Height * src_tmp.Font.InvRasterizationDensity;
             float u0 = (tx) / (float)atlas->TexWidth;
-            float v0 = (ty) / (float)atlas->TexHeight;
+            float v0 = (tex_page_ty) / (float)atlas->TexHeight;
             float u1 = (tx + info.Width) / (float)atlas->TexWidth;
-            float v1 = (ty + info.Height) / (float)atlas->TexHeight;
-            dst_font->AddGlyph(&cfg, (ImWchar)src_glyph.Codepoint, x0, y0, x1, y1, u0, v0, u1, v1, info.AdvanceX * src_tmp.Font.InvRasterizationDensity);
+            float v1 = (tex_page_ty + info.Height) / (float)atlas->TexHeight;
+            dst_font->AddGlyph(&cfg, (ImWchar)src_glyph.Codepoint, x0, y0, x1, y1, u0, v0, u1, v1, info.AdvanceX * src_tmp.Font.InvRasterizationDensity, tex_page);
 
             ImFontGlyph* dst_glyph = &dst_font->Glyphs.back();
             IM_ASSERT(dst_glyph->Codepoint == src_glyph.Codepoint);
@@ -837,8 +868,7 @@ static bool ImFontAtlasBuildWithFreeType(ImFontAtlas* atlas)
 
 const ImFontBuilderIO* ImGuiFreeType::GetBuilderForFreeType()
 {
-    static ImFontBuilderIO io;
-    io.FontBuilder_Build = ImFontAtlasBuildWithFreeType;
+    static const ImFontBuilderIO io = { ImFontAtlasBuildWithFreeType };
     return &io;
 }
 
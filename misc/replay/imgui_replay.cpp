@@ -0,0 +1,617 @@
+// dear imgui: deterministic input recording and replay
+// (code)
+
+// See imgui_replay.h for usage.
+
+// CHANGELOG
+// (minor and older changes stripped away, please see git history for details)
+//  2026/10/18: initial version.
+
+// Stream format (integers are LEB128 varints, signed values are zigzag-encoded, floats and hashes are little-endian):
+// - Header: 'IMRP' magic, version.
+// - For each frame:
+//   - Flags (ImGuiReplayFrameFlags_), io.DeltaTime, io.DisplaySize (if changed), io.DisplayFramebufferScale (if changed).
+//   - Number of events, followed by events. Each event starts with a byte: type (3 bits), Down/Focused (1 bit),
+//     mouse source (2 bits), extra flag (1 bit), followed by type-specific data:
+//     - MousePos: delta from previous integer position, or two floats when extra flag is set (non-integer or -FLT_MAX position).
+//     - MouseWheel: two floats.
+//     - MouseButton: button index.
+//     - Key: key, followed by analog value when extra flag is set (value is not 0.0f/1.0f).
+//     - Text: character.
+//     - Focus: no data.
+//   - Frame time in microseconds (0 if unknown), then ImDrawData hash presence (1 byte) and hash.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_replay.h"
+#include "imgui_internal.h"     // ImGuiContextHook, ImGuiInputEvent, ImHashData, ImFileOpen
+#include <string.h>             // memcpy
+#include <math.h>               // floorf, fabsf
+#include <chrono>               // std::chrono::steady_clock
+
+// Bump when the stream format changes. Replayer rejects other versions.
+#define IMGUI_REPLAY_VERSION        1
+
+enum ImGuiReplayFrameFlags_
+{
+    ImGuiReplayFrameFlags_DisplaySize       = 1 << 0,
+    ImGuiReplayFrameFlags_FramebufferScale  = 1 << 1,
+};
+
+enum ImGuiReplayEventBits_
+{
+    ImGuiReplayEventBits_TypeMask           = 0x07,
+    ImGuiReplayEventBits_Down               = 1 << 3,   // MouseButton/Key: Down, Focus: Focused
+    ImGuiReplayEventBits_MouseSourceShift   = 4,        // 2 bits
+    ImGuiReplayEventBits_Extra              = 1 << 6,   // MousePos: raw floats, Key: analog value follows
+};
+
+//-------------------------------------------------------------------------
+// [SECTION] Helpers
+//-------------------------------------------------------------------------
+
+static ImU64 ImGuiReplayGetTimeUs()
+{
+    return (ImU64)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void ImGuiReplayWriteU8(ImVector<unsigned char>* out, unsigned char v)
+{
+    out->push_back(v);
+}
+
+static void ImGuiReplayWriteU32(ImVector<unsigned char>* out, ImU32 v)
+{
+    while (v >= 0x80)
+    {
+        out->push_back((unsigned char)(v | 0x80));
+        v >>= 7;
+    }
+    out->push_back((unsigned char)v);
+}
+
+static void ImGuiReplayWriteS32(ImVector<unsigned char>* out, int v)
+{
+    ImGuiReplayWriteU32(out, ((ImU32)v << 1) ^ (ImU32)(v >> 31));
+}
+
+static void ImGuiReplayWriteU32LE(ImVector<unsigned char>* out, ImU32 v)
+{
+    for (int shift = 0; shift < 32; shift += 8)
+        out->push_back((unsigned char)(v >> shift));
+}
+
+static void ImGuiReplayWriteF32(ImVector<unsigned char>* out, float v)
+{
+    ImU32 u;
+    memcpy(&u, &v, 4);
+    ImGuiReplayWriteU32LE(out, u);
+}
+
+struct ImGuiReplayReader
+{
+    const unsigned char*    P;
+    const unsigned char*    End;
+    bool                    Error;
+
+    ImGuiReplayReader(const void* data, size_t size) { P = (const unsigned char*)data; End = P + size; Error = false; }
+
+    unsigned char ReadU8()
+    {
+        if (P >= End) { Error = true; return 0; }
+        return *P++;
+    }
+    ImU32 ReadU32()
+    {
+        ImU32 v = 0;
+        for (int shift = 0; shift < 35; shift += 7)
+        {
+            if (P >= End)
+                break;
+            const unsigned char b = *P++;
+            v |= (ImU32)(b & 0x7F) << shift;
+            if ((b & 0x80) == 0)
+                return v;
+        }
+        Error = true;
+        return 0;
+    }
+    int ReadS32()
+    {
+        const ImU32 v = ReadU32();
+        return (int)(v >> 1) ^ -(int)(v & 1);
+    }
+    ImU32 ReadU32LE()
+    {
+        if (End - P < 4) { Error = true; P = End; return 0; }
+        const ImU32 v = (ImU32)P[0] | ((ImU32)P[1] << 8) | ((ImU32)P[2] << 16) | ((ImU32)P[3] << 24);
+        P += 4;
+        return v;
+    }
+    float ReadF32()
+    {
+        const ImU32 u = ReadU32LE();
+        float v;
+        memcpy(&v, &u, 4);
+        return v;
+    }
+};
+
+// Texture identifiers and callbacks are not hashed: they are typically pointers which vary from one run to another.
+static ImU32 ImGuiReplayHashDrawData(const ImDrawData* draw_data)
+{
+    ImU32 hash = ImHashData(&draw_data->DisplayPos, sizeof(ImVec2), 0);
+    hash = ImHashData(&draw_data->DisplaySize, sizeof(ImVec2), hash);
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            const unsigned int cmd_data[3] = { cmd.VtxOffset, cmd.IdxOffset, cmd.ElemCount };
+            hash = ImHashData(&cmd.ClipRect, sizeof(ImVec4), hash);
+            hash = ImHashData(cmd_data, sizeof(cmd_data), hash);
+        }
+        hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+        hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+    }
+    return hash;
+}
+
+static bool ImGuiReplayIsIntegerPos(float v)
+{
+    return v == floorf(v) && fabsf(v) < (float)(1 << 30);
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] ImGuiInputRecorder
+//-------------------------------------------------------------------------
+
+static void ImGuiInputRecorderWriteFrameTrailer(ImGuiInputRecorder* recorder, ImU64 frame_time_us, const ImDrawData* draw_data)
+{
+    ImGuiReplayWriteU32(&recorder->Data, (ImU32)ImMin(frame_time_us, (ImU64)0xFFFFFFFF));
+    ImGuiReplayWriteU8(&recorder->Data, draw_data ? 1 : 0);
+    if (draw_data)
+        ImGuiReplayWriteU32LE(&recorder->Data, ImGuiReplayHashDrawData(draw_data));
+    recorder->FramePending = false;
+    recorder->FramesCount++;
+}
+
+static void ImGuiInputRecorderWriteEvent(ImGuiInputRecorder* recorder, const ImGuiInputEvent* e)
+{
+    ImVector<unsigned char>* out = &recorder->Data;
+    unsigned char header = (unsigned char)e->Type;
+    switch (e->Type)
+    {
+    case ImGuiInputEventType_MousePos:
+    {
+        const bool compact = ImGuiReplayIsIntegerPos(e->MousePos.PosX) && ImGuiReplayIsIntegerPos(e->MousePos.PosY);
+        header |= (unsigned char)((e->MousePos.MouseSource << ImGuiReplayEventBits_MouseSourceShift) | (compact ? 0 : ImGuiReplayEventBits_Extra));
+        ImGuiReplayWriteU8(out, header);
+        if (compact)
+        {
+            const int x = (int)e->MousePos.PosX, y = (int)e->MousePos.PosY;
+            ImGuiReplayWriteS32(out, x - recorder->LastMousePosX);
+            ImGuiReplayWriteS32(out, y - recorder->LastMousePosY);
+            recorder->LastMousePosX = x;
+            recorder->LastMousePosY = y;
+        }
+        else
+        {
+            ImGuiReplayWriteF32(out, e->MousePos.PosX);
+            ImGuiReplayWriteF32(out, e->MousePos.PosY);
+        }
+        break;
+    }
+    case ImGuiInputEventType_MouseWheel:
+        ImGuiReplayWriteU8(out, header | (unsigned char)(e->MouseWheel.MouseSource << ImGuiReplayEventBits_MouseSourceShift));
+        ImGuiReplayWriteF32(out, e->MouseWheel.WheelX);
+        ImGuiReplayWriteF32(out, e->MouseWheel.WheelY);
+        break;
+    case ImGuiInputEventType_MouseButton:
+        ImGuiReplayWriteU8(out, header | (unsigned char)((e->MouseButton.MouseSource << ImGuiReplayEventBits_MouseSourceShift) | (e->MouseButton.Down ? ImGuiReplayEventBits_Down : 0)));
+        ImGuiReplayWriteU32(out, (ImU32)e->MouseButton.Button);
+        break;
+    case ImGuiInputEventType_Key:
+    {
+        const bool has_analog = e->Key.AnalogValue != (e->Key.Down ? 1.0f : 0.0f);
+        ImGuiReplayWriteU8(out, header | (unsigned char)((e->Key.Down ? ImGuiReplayEventBits_Down : 0) | (has_analog ? ImGuiReplayEventBits_Extra : 0)));
+        ImGuiReplayWriteU32(out, (ImU32)e->Key.Key);
+        if (has_analog)
+            ImGuiReplayWriteF32(out, e->Key.AnalogValue);
+        break;
+    }
+    case ImGuiInputEventType_Text:
+        ImGuiReplayWriteU8(out, header);
+        ImGuiReplayWriteU32(out, e->Text.Char);
+        break;
+    case ImGuiInputEventType_Focus:
+        ImGuiReplayWriteU8(out, header | (unsigned char)(e->AppFocused.Focused ? ImGuiReplayEventBits_Down : 0));
+        break;
+    default:
+        IM_ASSERT(0 && "Unknown event!");
+        break;
+    }
+}
+
+static void ImGuiInputRecorderHook_NewFramePre(ImGuiContext* ctx, ImGuiContextHook* hook)
+{
+    ImGuiInputRecorder* recorder = (ImGuiInputRecorder*)hook->UserData;
+    ImGuiContext& g = *ctx;
+    ImGuiIO& io = g.IO;
+    if (recorder->FramePending)
+        ImGuiInputRecorderWriteFrameTrailer(recorder, 0, NULL); // Previous frame didn't call Render()
+
+    // Frame header
+    ImVector<unsigned char>* out = &recorder->Data;
+    unsigned char flags = 0;
+    if (recorder->FramesCount == 0 || io.DisplaySize.x != recorder->LastDisplaySize.x || io.DisplaySize.y != recorder->LastDisplaySize.y)
+        flags |= ImGuiReplayFrameFlags_DisplaySize;
+    if (recorder->FramesCount == 0 || io.DisplayFramebufferScale.x != recorder->LastFramebufferScale.x || io.DisplayFramebufferScale.y != recorder->LastFramebufferScale.y)
+        flags |= ImGuiReplayFrameFlags_FramebufferScale;
+    ImGuiReplayWriteU8(out, flags);
+    ImGuiReplayWriteF32(out, io.DeltaTime);
+    if (flags & ImGuiReplayFrameFlags_DisplaySize)
+    {
+        ImGuiReplayWriteF32(out, io.DisplaySize.x);
+        ImGuiReplayWriteF32(out, io.DisplaySize.y);
+        recorder->LastDisplaySize = io.DisplaySize;
+    }
+    if (flags & ImGuiReplayFrameFlags_FramebufferScale)
+    {
+        ImGuiReplayWriteF32(out, io.DisplayFramebufferScale.x);
+        ImGuiReplayWriteF32(out, io.DisplayFramebufferScale.y);
+        recorder->LastFramebufferScale = io.DisplayFramebufferScale;
+    }
+
+    // Events queued since last frame. On the first frame, record the whole queue, including events left over by trickling.
+    // Events posted from other threads are moved into the queue now, instead of at the beginning of UpdateInputEvents().
+    // Raw events coalesced by the thread queue ('TrailOnly') are skipped: the event summing them is recorded instead.
+#ifdef IMGUI_ENABLE_INPUT_THREAD_QUEUE
+    ImGui::UpdateInputEventThreadQueue();
+#endif
+    int events_count = 0;
+    for (const ImGuiInputEvent& e : g.InputEventsQueue)
+        if (!e.TrailOnly && (recorder->FramesCount == 0 || (int)(e.EventId - recorder->NextEventId) >= 0))
+            events_count++;
+    ImGuiReplayWriteU32(out, (ImU32)events_count);
+    for (const ImGuiInputEvent& e : g.InputEventsQueue)
+        if (!e.TrailOnly && (recorder->FramesCount == 0 || (int)(e.EventId - recorder->NextEventId) >= 0))
+            ImGuiInputRecorderWriteEvent(recorder, &e);
+    recorder->NextEventId = g.InputEventsNextEventId;
+
+    recorder->FramePending = true;
+    recorder->FrameStartTime = ImGuiReplayGetTimeUs();
+}
+
+static void ImGuiInputRecorderHook_RenderPost(ImGuiContext* ctx, ImGuiContextHook* hook)
+{
+    ImGuiInputRecorder* recorder = (ImGuiInputRecorder*)hook->UserData;
+    if (!recorder->FramePending)
+        return;
+    const ImU64 frame_time_us = ImGuiReplayGetTimeUs() - recorder->FrameStartTime;
+    ImGuiInputRecorderWriteFrameTrailer(recorder, frame_time_us, recorder->RecordDrawDataHash ? ImGui::GetDrawData() : NULL);
+    IM_UNUSED(ctx);
+}
+
+ImGuiInputRecorder::ImGuiInputRecorder()
+{
+    FramesCount = 0;
+    RecordDrawDataHash = true;
+    Ctx = NULL;
+    HookIdNewFrame = HookIdRender = 0;
+    NextEventId = 0;
+    FramePending = false;
+    FrameStartTime = 0;
+    LastMousePosX = LastMousePosY = 0;
+}
+
+ImGuiInputRecorder::~ImGuiInputRecorder()
+{
+    IM_ASSERT(Ctx == NULL && "Call Stop() before destroying the recorder!");
+}
+
+void ImGuiInputRecorder::Start(ImGuiContext* ctx)
+{
+    IM_ASSERT(ctx != NULL && Ctx == NULL);
+    Ctx = ctx;
+    Data.resize(0);
+    Data.push_back('I'); Data.push_back('M'); Data.push_back('R'); Data.push_back('P');
+    ImGuiReplayWriteU32(&Data, IMGUI_REPLAY_VERSION);
+    FramesCount = 0;
+    FramePending = false;
+    LastMousePosX = LastMousePosY = 0;
+    LastDisplaySize = LastFramebufferScale = ImVec2(0.0f, 0.0f);
+
+    ImGuiContextHook hook;
+    hook.UserData = this;
+    hook.Type = ImGuiContextHookType_NewFramePre;
+    hook.Callback = ImGuiInputRecorderHook_NewFramePre;
+    HookIdNewFrame = ImGui::AddContextHook(ctx, &hook);
+    hook.Type = ImGuiContextHookType_RenderPost;
+    hook.Callback = ImGuiInputRecorderHook_RenderPost;
+    HookIdRender = ImGui::AddContextHook(ctx, &hook);
+}
+
+void ImGuiInputRecorder::Stop()
+{
+    if (Ctx == NULL)
+        return;
+    if (FramePending)
+        ImGuiInputRecorderWriteFrameTrailer(this, 0, NULL); // Stopped during a frame
+    ImGui::RemoveContextHook(Ctx, HookIdNewFrame);
+    ImGui::RemoveContextHook(Ctx, HookIdRender);
+    HookIdNewFrame = HookIdRender = 0;
+    Ctx = NULL;
+}
+
+bool ImGuiInputRecorder::SaveToFile(const char* filename) const
+{
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ok = ImFileWrite(Data.Data, 1, (ImU64)Data.Size, f) == (ImU64)Data.Size;
+    ImFileClose(f);
+    return ok;
+}
+
+//-------------------------------------------------------------------------
+// [SECTION] ImGuiInputReplayer
+//-------------------------------------------------------------------------
+
+// Read one frame. When 'io' is NULL only validate it, otherwise also apply it.
+static bool ImGuiInputReplayerReadFrame(ImGuiReplayReader* r, ImGuiIO* io, int* last_mouse_x, int* last_mouse_y, ImU32* out_time_us, bool* out_has_hash, ImU32* out_hash)
+{
+    const unsigned char flags = r->ReadU8();
+    const float delta_time = r->ReadF32();
+    if (io)
+        io->DeltaTime = delta_time;
+    if (flags & ImGuiReplayFrameFlags_DisplaySize)
+    {
+        const float x = r->ReadF32(), y = r->ReadF32();
+        if (!(x >= 0.0f && y >= 0.0f))
+            r->Error = true;
+        if (io)
+            io->DisplaySize = ImVec2(x, y);
+    }
+    if (flags & ImGuiReplayFrameFlags_FramebufferScale)
+    {
+        const float x = r->ReadF32(), y = r->ReadF32();
+        if (io)
+            io->DisplayFramebufferScale = ImVec2(x, y);
+    }
+    if (r->Error || !(delta_time >= 0.0f))
+        return false;
+
+    // Recorded events were already remapped
+    const bool backup_mac_behaviors = io ? io->ConfigMacOSXBehaviors : false;
+    if (io)
+        io->ConfigMacOSXBehaviors = false;
+    const ImU32 events_count = r->ReadU32();
+    for (ImU32 n = 0; n < events_count && !r->Error; n++)
+    {
+        const unsigned char header = r->ReadU8();
+        const int type = header & ImGuiReplayEventBits_TypeMask;
+        const bool down = (header & ImGuiReplayEventBits_Down) != 0;
+        const bool extra = (header & ImGuiReplayEventBits_Extra) != 0;
+        const ImGuiMouseSource mouse_source = (ImGuiMouseSource)((header >> ImGuiReplayEventBits_MouseSourceShift) & 0x03);
+        if (mouse_source >= ImGuiMouseSource_COUNT)
+            r->Error = true;
+        if (type == ImGuiInputEventType_MousePos)
+        {
+            float x, y;
+            if (extra)
+            {
+                x = r->ReadF32();
+                y = r->ReadF32();
+            }
+            else
+            {
+                const ImS64 pos_x = (ImS64)*last_mouse_x + r->ReadS32();
+                const ImS64 pos_y = (ImS64)*last_mouse_y + r->ReadS32();
+                if (pos_x <= -(1 << 30) || pos_x >= (1 << 30) || pos_y <= -(1 << 30) || pos_y >= (1 << 30))
+                    r->Error = true;
+                *last_mouse_x = (int)pos_x;
+                *last_mouse_y = (int)pos_y;
+                x = (float)*last_mouse_x;
+                y = (float)*last_mouse_y;
+            }
+            if (io && !r->Error)
+            {
+                io->AddMouseSourceEvent(mouse_source);
+                io->AddMousePosEvent(x, y);
+            }
+        }
+        else if (type == ImGuiInputEventType_MouseWheel)
+        {
+            const float wheel_x = r->ReadF32(), wheel_y = r->ReadF32();
+            if (io && !r->Error)
+            {
+                io->AddMouseSourceEvent(mouse_source);
+                io->AddMouseWheelEvent(wheel_x, wheel_y);
+            }
+        }
+        else if (type == ImGuiInputEventType_MouseButton)
+        {
+            const ImU32 button = r->ReadU32();
+            if (button >= ImGuiMouseButton_COUNT)
+                r->Error = true;
+            if (io && !r->Error)
+            {
+                io->AddMouseSourceEvent(mouse_source);
+                io->AddMouseButtonEvent((int)button, down);
+            }
+        }
+        else if (type == ImGuiInputEventType_Key)
+        {
+            const ImGuiKey key = (ImGuiKey)r->ReadU32();
+            const float analog_value = extra ? r->ReadF32() : (down ? 1.0f : 0.0f);
+            if (!ImGui::IsNamedKeyOrMod(key) || ImGui::IsAliasKey(key))
+                r->Error = true;
+            if (io && !r->Error)
+                io->AddKeyAnalogEvent(key, down, analog_value);
+        }
+        else if (type == ImGuiInputEventType_Text)
+        {
+            const ImU32 c = r->ReadU32();
+            if (io && !r->Error)
+                io->AddInputCharacter(c);
+        }
+        else if (type == ImGuiInputEventType_Focus)
+        {
+            if (io)
+                io->AddFocusEvent(down);
+        }
+        else
+        {
+            r->Error = true;
+        }
+    }
+    if (io)
+        io->ConfigMacOSXBehaviors = backup_mac_behaviors;
+
+    // Trailer
+    *out_time_us = r->ReadU32();
+    *out_has_hash = r->ReadU8() != 0;
+    *out_hash = *out_has_hash ? r->ReadU32LE() : 0;
+    return !r->Error;
+}
+
+static void ImGuiInputReplayerHook_NewFramePre(ImGuiContext* ctx, ImGuiContextHook* hook)
+{
+    ImGuiInputReplayer* replayer = (ImGuiInputReplayer*)hook->UserData;
+    if (replayer->FramePending)
+        replayer->FramePending = false; // Previous frame didn't call Render(): no hash to compare.
+    if (replayer->FrameIndex >= replayer->FramesCount)
+        return;
+
+    ImGuiReplayReader r(replayer->Data.Data + replayer->ReadOffset, (size_t)(replayer->Data.Size - replayer->ReadOffset));
+    ImU32 time_us = 0;
+    const bool ok = ImGuiInputReplayerReadFrame(&r, &ctx->IO, &replayer->LastMousePosX, &replayer->LastMousePosY, &time_us, &replayer->FrameHasHash, &replayer->FrameHash);
+    IM_ASSERT(ok); // Stream was validated on load
+    IM_UNUSED(ok);
+    replayer->ReadOffset = (int)(r.P - replayer->Data.Data);
+    replayer->FrameIndex++;
+    replayer->FramePending = true;
+    replayer->FrameStartTime = ImGuiReplayGetTimeUs();
+}
+
+static void ImGuiInputReplayerHook_RenderPost(ImGuiContext* ctx, ImGuiContextHook* hook)
+{
+    ImGuiInputReplayer* replayer = (ImGuiInputReplayer*)hook->UserData;
+    if (!replayer->FramePending)
+        return;
+    replayer->ReplayedFrameTimes.push_back((float)(ImGuiReplayGetTimeUs() - replayer->FrameStartTime) / 1000.0f);
+    const ImDrawData* draw_data = ImGui::GetDrawData();
+    IM_UNUSED(ctx);
+    if (replayer->FrameHasHash && (draw_data == NULL || ImGuiReplayHashDrawData(draw_data) != replayer->FrameHash))
+    {
+        if (replayer->HashMismatchCount++ == 0)
+            replayer->FirstHashMismatchFrame = replayer->FrameIndex - 1;
+    }
+    replayer->FramePending = false;
+}
+
+ImGuiInputReplayer::ImGuiInputReplayer()
+{
+    FramesCount = FrameIndex = 0;
+    HashMismatchCount = 0;
+    FirstHashMismatchFrame = -1;
+    Ctx = NULL;
+    HookIdNewFrame = HookIdRender = 0;
+    ReadOffset = 0;
+    FramePending = FrameHasHash = false;
+    FrameHash = 0;
+    FrameStartTime = 0;
+    LastMousePosX = LastMousePosY = 0;
+}
+
+ImGuiInputReplayer::~ImGuiInputReplayer()
+{
+    IM_ASSERT(Ctx == NULL && "Call Stop() before destroying the replayer!");
+}
+
+bool ImGuiInputReplayer::LoadFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(Ctx == NULL && "Cannot load while replaying!");
+    Data.resize(0);
+    FramesCount = 0;
+    RecordedFrameTimes.resize(0);
+
+    ImGuiReplayReader r(data, data_size);
+    if (data_size < 4 || memcmp(data, "IMRP", 4) != 0 || data_size > (size_t)INT_MAX)
+        return false;
+    r.P += 4;
+    if (r.ReadU32() != IMGUI_REPLAY_VERSION)
+        return false;
+
+    // Validate all frames, so that replay never has to deal with a malformed stream
+    int mouse_x = 0, mouse_y = 0;
+    while (r.P < r.End)
+    {
+        ImU32 time_us = 0, hash = 0;
+        bool has_hash = false;
+        if (!ImGuiInputReplayerReadFrame(&r, NULL, &mouse_x, &mouse_y, &time_us, &has_hash, &hash))
+        {
+            FramesCount = 0;
+            RecordedFrameTimes.resize(0);
+            return false;
+        }
+        RecordedFrameTimes.push_back((float)time_us / 1000.0f);
+        FramesCount++;
+    }
+    Data.resize((int)data_size);
+    memcpy(Data.Data, data, data_size);
+    return true;
+}
+
+bool ImGuiInputReplayer::LoadFromFile(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size);
+    if (!data)
+        return false;
+    const bool ok = LoadFromMemory(data, data_size);
+    IM_FREE(data);
+    return ok;
+}
+
+void ImGuiInputReplayer::Start(ImGuiContext* ctx)
+{
+    IM_ASSERT(ctx != NULL && Ctx == NULL);
+    IM_ASSERT(Data.Size > 0 && "Call LoadFromMemory() or LoadFromFile() first!");
+    Ctx = ctx;
+    FrameIndex = 0;
+    ReadOffset = 4;
+    {
+        ImGuiReplayReader r(Data.Data + ReadOffset, (size_t)(Data.Size - ReadOffset));
+        r.ReadU32(); // Version
+        ReadOffset = (int)(r.P - Data.Data);
+    }
+    FramePending = false;
+    HashMismatchCount = 0;
+    FirstHashMismatchFrame = -1;
+    ReplayedFrameTimes.resize(0);
+    ReplayedFrameTimes.reserve(FramesCount);
+    LastMousePosX = LastMousePosY = 0;
+
+    ImGuiContextHook hook;
+    hook.UserData = this;
+    hook.Type = ImGuiContextHookType_NewFramePre;
+    hook.Callback = ImGuiInputReplayerHook_NewFramePre;
+    HookIdNewFrame = ImGui::AddContextHook(ctx, &hook);
+    hook.Type = ImGuiContextHookType_RenderPost;
+    hook.Callback = ImGuiInputReplayerHook_RenderPost;
+    HookIdRender = ImGui::AddContextHook(ctx, &hook);
+}
+
+void ImGuiInputReplayer::Stop()
+{
+    if (Ctx == NULL)
+        return;
+    ImGui::RemoveContextHook(Ctx, HookIdNewFrame);
+    ImGui::RemoveContextHook(Ctx, HookIdRender);
+    HookIdNewFrame = HookIdRender = 0;
+    FramePending = false;
+    Ctx = NULL;
+}
+
+#endif // #ifndef IMGUI_DISABLE
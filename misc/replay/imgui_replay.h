@@ -0,0 +1,106 @@
+// dear imgui: deterministic input recording and replay
+// (headers)
+
+// Record a real session (inputs, io.DeltaTime, io.DisplaySize) into a compact stream, then replay it
+// in a headless context against a newer build, comparing ImDrawData hashes and frame timings.
+
+// Usage:
+// - Add misc/replay/imgui_replay.cpp to your project.
+// - Recording, e.g. in your regular application:
+//      static ImGuiInputRecorder recorder;
+//      recorder.Start(ImGui::GetCurrentContext());    // Ideally before the first NewFrame(), see notes below.
+//      [...]
+//      recorder.Stop();
+//      recorder.SaveToFile("session.imrec");
+// - Replaying, e.g. in a headless application running the same UI code (see examples/example_null_replay/):
+//      static ImGuiInputReplayer replayer;
+//      if (replayer.LoadFromFile("session.imrec"))
+//      {
+//          replayer.Start(ImGui::GetCurrentContext());
+//          while (replayer.IsPlaying())
+//          {
+//              ImGui::NewFrame();                      // io.DeltaTime, io.DisplaySize and input events are set by the replayer.
+//              MyUserCode();
+//              ImGui::Render();                        // ImDrawData hash and frame time are checked by the replayer.
+//          }
+//          replayer.Stop();
+//          printf("%d/%d frames differ\n", replayer.HashMismatchCount, replayer.FramesCount);
+//      }
+
+// Notes:
+// - Both sides use context hooks (NewFramePre and RenderPost), so no changes to the main loop are required.
+// - Replay is deterministic when it starts from the same state as the recording. Start the recorder before the first
+//   NewFrame() of a fresh context, and set io.IniFilename = NULL on both sides (or ship the same .ini file).
+//   Anything else your UI code reads (clock, files, network, random numbers) also needs to be reproduced.
+// - Recorded events are the ones queued into the context, after io.AddXXXEvent() filtering and ConfigMacOSXBehaviors
+//   remapping. The replayer submits them back through io.AddXXXEvent() with ConfigMacOSXBehaviors temporarily disabled.
+//   Events posted with PostInputEventThreadSafe() are flushed at the beginning of the frame and recorded as well.
+// - Frame time is measured from NewFrame() to the end of Render(), so it includes your UI code.
+// - The ImDrawData hash covers vertices, indices, clip rectangles and element counts, but not texture identifiers or callbacks.
+
+#pragma once
+#include "imgui.h"      // IMGUI_API, ImDrawData
+#ifndef IMGUI_DISABLE
+
+struct ImGuiContext;
+
+// Recorder
+struct IMGUI_API ImGuiInputRecorder
+{
+    ImVector<unsigned char> Data;               // Recorded stream. Save with SaveToFile() or your own I/O.
+    int                     FramesCount;        // Number of frames in Data.
+    bool                    RecordDrawDataHash; // = true   // Store a hash of ImDrawData for every frame. Disable to save a little CPU time while recording.
+
+    // [Internal]
+    ImGuiContext*           Ctx;
+    ImGuiID                 HookIdNewFrame;
+    ImGuiID                 HookIdRender;
+    ImU32                   NextEventId;        // Events in the queue with an id greater or equal have not been recorded yet.
+    bool                    FramePending;       // Frame header and events were written, but not the trailer.
+    ImU64                   FrameStartTime;
+    ImVec2                  LastDisplaySize;
+    ImVec2                  LastFramebufferScale;
+    int                     LastMousePosX, LastMousePosY;
+
+    ImGuiInputRecorder();
+    ~ImGuiInputRecorder();
+    void                    Start(ImGuiContext* ctx);               // Clear Data and start recording.
+    void                    Stop();
+    bool                    IsRecording() const { return Ctx != NULL; }
+    bool                    SaveToFile(const char* filename) const;
+};
+
+// Replayer
+struct IMGUI_API ImGuiInputReplayer
+{
+    ImVector<unsigned char> Data;               // Stream to replay, set by LoadFromMemory()/LoadFromFile().
+    int                     FramesCount;        // Number of frames in Data.
+    int                     FrameIndex;         // Next frame to replay.
+
+    // Results, valid after each replayed frame
+    int                     HashMismatchCount;  // Frames whose ImDrawData hash differs from the recording.
+    int                     FirstHashMismatchFrame; // -1 if none.
+    ImVector<float>         RecordedFrameTimes; // Milliseconds, per frame, as recorded (0.0f if unknown).
+    ImVector<float>         ReplayedFrameTimes; // Milliseconds, per frame replayed so far.
+
+    // [Internal]
+    ImGuiContext*           Ctx;
+    ImGuiID                 HookIdNewFrame;
+    ImGuiID                 HookIdRender;
+    int                     ReadOffset;
+    bool                    FramePending;       // Frame was applied in NewFrame(), waiting for Render().
+    bool                    FrameHasHash;
+    ImU32                   FrameHash;
+    ImU64                   FrameStartTime;
+    int                     LastMousePosX, LastMousePosY;
+
+    ImGuiInputReplayer();
+    ~ImGuiInputReplayer();
+    bool                    LoadFromMemory(const void* data, size_t data_size);    // Copy and validate stream. Return false if malformed.
+    bool                    LoadFromFile(const char* filename);
+    void                    Start(ImGuiContext* ctx);               // Rewind and start replaying on next NewFrame().
+    void                    Stop();
+    bool                    IsPlaying() const { return Ctx != NULL && (FrameIndex < FramesCount || FramePending); }
+};
+
+#endif // #ifndef IMGUI_DISABLE